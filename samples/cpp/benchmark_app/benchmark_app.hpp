@@ -73,6 +73,12 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximum rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for arrival process
+static const char arrival_message[] =
+    "Optional. Enables open-loop load generation: requests are issued at the rate set by -max_irate (requests per "
+    "second) regardless of completions, with \"constant\" or \"poisson\" inter-arrival times. Latencies are measured "
+    "from the scheduled arrival and include the queueing delay.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -319,6 +325,9 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Arrival process for the open-loop load generation
+DEFINE_string(arrival, "", arrival_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -404,6 +413,7 @@ static void show_usage() {
               << hint_message << std::endl;
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
+    std::cout << "    -arrival \"<string>\"         " << arrival_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
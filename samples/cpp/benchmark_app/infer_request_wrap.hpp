@@ -46,7 +46,13 @@ public:
     }
 
     void start_async() {
-        _startTime = Time::now();
+        start_async(Time::now());
+    }
+
+    /// @brief Starts the request with the latency accounted from the given arrival time, so that the time the
+    /// request waited in the queue is included
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
         _request.start_async();
     }
 
@@ -55,7 +61,11 @@ public:
     }
 
     void infer() {
-        _startTime = Time::now();
+        infer(Time::now());
+    }
+
+    void infer(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
@@ -120,6 +130,7 @@ public:
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
+        _first_group_latencies.resize(lat_group_n, -1.0);
         reset_times();
     }
 
@@ -157,6 +168,9 @@ public:
             _latencies.push_back(latency);
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
+                if (_first_group_latencies[lat_group_id] < 0) {
+                    _first_group_latencies[lat_group_id] = latency;
+                }
             }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
@@ -196,6 +210,13 @@ public:
         return _latency_groups;
     }
 
+    /// @brief Returns the latency of the very first inference of each shape group (or a negative value if the group was
+    /// never inferred), which includes the first-time shape costs such as kernel compilation and reallocation. Unlike
+    /// the group latencies, they are preserved by reset_times(), so the warm-up inference accounts for its shape.
+    std::vector<double> get_first_group_latencies() {
+        return _first_group_latencies;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -206,6 +227,7 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    std::vector<double> _first_group_latencies;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
 };
@@ -6,6 +6,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
 #include <thread>
 #include <utility>
@@ -146,6 +147,14 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (!FLAGS_arrival.empty()) {
+        if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+            throw std::logic_error("Incorrect arrival process. Please set -arrival option to `constant` or `poisson`.");
+        }
+        if (FLAGS_max_irate <= 0) {
+            throw std::logic_error("Open-loop load generation requires a positive target rate set by -max_irate.");
+        }
+    }
     if (FLAGS_api == "sync") {
         if ((FLAGS_t == 0) && FLAGS_niter != 0 && (FLAGS_nireq > FLAGS_niter)) {
             throw std::logic_error(
@@ -327,6 +336,25 @@ void fuse_mean_scale(ov::preprocess::PrePostProcessor& preproc, const benchmark_
         }
     }
 }
+
+/// @brief Reports whether the compiled model was served from the model cache, so that cold and warm startup
+/// measurements can be told apart
+void report_cache_state(const ov::CompiledModel& compiled_model, const std::shared_ptr<StatisticsReport>& statistics) {
+    bool loaded_from_cache = false;
+    try {
+        loaded_from_cache = compiled_model.get_property(ov::loaded_from_cache);
+    } catch (const ov::Exception&) {
+        // the device doesn't report the cache state
+        return;
+    }
+    slog::info << "Compiled model was " << (loaded_from_cache ? "loaded from cache" : "compiled without cache hit")
+               << slog::endl;
+    if (statistics) {
+        statistics->add_parameters(
+            StatisticsReport::Category::EXECUTION_RESULTS,
+            {StatisticsVariant("loaded from cache", "loaded_from_cache", loaded_from_cache ? "yes" : "no")});
+    }
+}
 }  // namespace
 
 /**
@@ -671,6 +699,7 @@ int main(int argc, char* argv[]) {
                 statistics->add_parameters(
                     StatisticsReport::Category::EXECUTION_RESULTS,
                     {StatisticsVariant("compile model time (ms)", "load_model_time", duration_ms)});
+            report_cache_state(compiledModel, statistics);
 
             convert_io_names_in_map(inputFiles, compiledModel.inputs());
             app_inputs_info = get_inputs_info(FLAGS_shape,
@@ -864,6 +893,7 @@ int main(int argc, char* argv[]) {
                 statistics->add_parameters(
                     StatisticsReport::Category::EXECUTION_RESULTS,
                     {StatisticsVariant("compile model time (ms)", "load_model_time", duration_ms)});
+            report_cache_state(compiledModel, statistics);
         } else {
             if (!FLAGS_mean_values.empty() || !FLAGS_scale_values.empty()) {
                 throw std::runtime_error("--mean_values and --scale_values aren't supported for compiled model. "
@@ -1260,12 +1290,26 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // open-loop mode: requests are issued on a precomputed arrival schedule, independently of completions
+        const bool openLoop = !FLAGS_arrival.empty();
+        std::mt19937 arrivalGenerator(0);
+        std::exponential_distribution<double> interArrival(openLoop ? FLAGS_max_irate : 1.0);
+        auto nextArrival = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            Time::time_point arrivalTime;
+            if (openLoop) {
+                std::this_thread::sleep_until(nextArrival);
+                arrivalTime = nextArrival;
+                const double interval =
+                    FLAGS_arrival == "poisson" ? interArrival(arrivalGenerator) : 1.0 / FLAGS_max_irate;
+                nextArrival += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
@@ -1298,7 +1342,13 @@ int main(int argc, char* argv[]) {
             }
 
             if (FLAGS_api == "sync") {
-                inferRequest->infer();
+                if (openLoop) {
+                    inferRequest->infer(arrivalTime);
+                } else {
+                    inferRequest->infer();
+                }
+            } else if (openLoop) {
+                inferRequest->start_async(arrivalTime);
             } else {
                 inferRequest->start_async();
             }
@@ -1307,7 +1357,7 @@ int main(int argc, char* argv[]) {
             execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
             processedFramesN += batchSize;
 
-            if (FLAGS_max_irate > 0) {
+            if (FLAGS_max_irate > 0 && !openLoop) {
                 auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
                 std::this_thread::sleep_for(
                     std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
@@ -1318,6 +1368,16 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.wait_all();
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        std::vector<std::pair<std::string, double>> tailLatencies;
+        if (openLoop) {
+            auto latencies = inferRequestsQueue.get_latencies();
+            std::sort(latencies.begin(), latencies.end());
+            const std::vector<std::string> tailPercentiles = {"50", "90", "99", "99.9"};
+            for (const auto& percentile : tailPercentiles) {
+                const auto idx = static_cast<size_t>(latencies.size() / 100.0 * std::stod(percentile));
+                tailLatencies.emplace_back(percentile, latencies[std::min(idx, latencies.size() - 1)]);
+            }
+        }
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1356,6 +1416,13 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Average latency (ms)", "latency_avg", generalLatency.avg),
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
+                for (const auto& tail : tailLatencies) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("p" + tail.first + " latency with queueing (ms)",
+                                           "latency_p" + tail.first,
+                                           tail.second)});
+                }
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
@@ -1424,9 +1491,18 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            if (openLoop) {
+                slog::info << "Latency at " << double_to_string(FLAGS_max_irate) << " requests/s " << FLAGS_arrival
+                           << " arrival (including queueing):" << slog::endl;
+                for (const auto& tail : tailLatencies) {
+                    slog::info << "   p" << tail.first << ":" << std::string(15 - tail.first.size(), ' ')
+                               << double_to_string(tail.second) << " ms" << slog::endl;
+                }
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
+                const auto firstGroupLatencies = inferRequestsQueue.get_first_group_latencies();
                 for (size_t i = 0; i < app_inputs_info.size(); ++i) {
                     slog::info << (i + 1) << ".";
                     for (auto& item : app_inputs_info[i]) {
@@ -1439,6 +1515,10 @@ int main(int argc, char* argv[]) {
                     slog::info << slog::endl;
 
                     groupLatencies[i].write_to_slog();
+                    if (firstGroupLatencies[i] >= 0) {
+                        slog::info << "   First-seen shape: " << double_to_string(firstGroupLatencies[i]) << " ms"
+                                   << slog::endl;
+                    }
                 }
             }
         }
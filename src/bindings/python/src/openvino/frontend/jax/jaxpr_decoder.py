@@ -149,12 +149,17 @@ class JaxprPythonDecoder(Decoder):
         for _, decoder in self.params.items():
             self.m_decoders.append(decoder)
             node_visitor(decoder)
+        # constvars bound to the same array (e.g. tied weights) share a single Constant
+        converted_literals = {}
         for idx, node in enumerate(self.jaxpr.constvars):
-            decoder = self.convert_literal_to_constant_node(
-                literal=self.literals[idx],
-                name=self.name + "/" + f"const({id(node)})",
-                output_id=id(node)
-            )
+            literal = self.literals[idx]
+            name = self.name + "/" + f"const({id(node)})"
+            if id(literal) in converted_literals:
+                decoder = _JaxprPythonConstantDecoder(
+                    name=name, constant=converted_literals[id(literal)], output_id=id(node))
+            else:
+                decoder = self.convert_literal_to_constant_node(literal=literal, name=name, output_id=id(node))
+                converted_literals[id(literal)] = decoder.constant
             self.m_decoders.append(decoder)
             node_visitor(decoder)
         # Visit every `JaxEqn` in the jaxpr, see https://github.com/google/jax/blob/jaxlib-v0.4.29/jax/_src/core.py#L285
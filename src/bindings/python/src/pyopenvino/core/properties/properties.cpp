@@ -333,6 +333,7 @@ void regmodule_properties(py::module m) {
     py::enum_<ov::intel_auto::SchedulePolicy>(m_intel_auto, "SchedulePolicy", py::arithmetic())
         .value("ROUND_ROBIN", ov::intel_auto::SchedulePolicy::ROUND_ROBIN)
         .value("DEVICE_PRIORITY", ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)
+        .value("LATENCY_AWARE", ov::intel_auto::SchedulePolicy::LATENCY_AWARE)
         .value("DEFAULT", ov::intel_auto::SchedulePolicy::DEFAULT);
 
     wrap_property_RW(m_intel_auto, ov::intel_auto::device_bind_buffer, "device_bind_buffer");
@@ -5,8 +5,14 @@
 #include "openvino/itt.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "openvino/shutdown.hpp"
@@ -44,10 +50,198 @@ static std::mutex region_mutex;
 static thread_local uint64_t current_region_counter = 0;
 static thread_local void* current_region_handle = nullptr;
 
+/**
+ * In-process tracing backend which is used instead of ITT when no ITT collector is attached and the
+ * OPENVINO_TRACE_FILE environment variable is set. Tasks and regions are recorded into per-thread buffers, each
+ * guarded by its own mutex which is contended only while the trace is dumped, and are written as Chrome trace JSON
+ * (loadable by chrome://tracing and Perfetto) to the given file at process exit or ov::shutdown().
+ */
+namespace trace {
+
+struct Event {
+    const char* name;
+    const char* key;
+    uint64_t value;
+    int64_t begin_ns;
+    int64_t end_ns;
+};
+
+struct ThreadBuffer {
+    std::mutex mutex;  // taken by the owning thread on every event and by the dump of the other threads' buffers
+    size_t tid = 0;
+    std::string name;
+    std::vector<Event> events;
+    std::vector<size_t> open;  // indices of the events which have not ended yet
+    size_t dropped = 0;
+    // metadata keys are passed as literals, so each call site is interned once per thread
+    std::unordered_map<const char*, const char*> keys;
+};
+
+// bounds the memory of long-running processes, the events above the limit are counted but not recorded
+constexpr size_t max_events_per_thread = 1 << 20;
+
+static const char* trace_file() {
+    static const char* env = std::getenv("OPENVINO_TRACE_FILE");
+    return env;
+}
+
+static bool is_enabled() {
+    static const bool enabled = !is_initialized() && trace_file() && *trace_file();
+    return enabled;
+}
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void write_escaped(std::ostream& out, const std::string& str) {
+    for (const auto c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+    }
+}
+
+class Collector {
+public:
+    // never destroyed, so that threads which still trace during the static destruction don't touch freed memory
+    static Collector& get() {
+        static Collector* collector = [] {
+            auto instance = new Collector();
+            std::atexit([] {
+                get().dump();
+            });
+            return instance;
+        }();
+        return *collector;
+    }
+
+    const char* intern(const char* name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_names.insert(name).first->c_str();
+    }
+
+    ThreadBuffer& buffer() {
+        static thread_local ThreadBuffer* thread_buffer = nullptr;
+        if (thread_buffer == nullptr) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_buffers.push_back(std::make_unique<ThreadBuffer>());
+            thread_buffer = m_buffers.back().get();
+            thread_buffer->tid = m_buffers.size();
+        }
+        return *thread_buffer;
+    }
+
+    void begin(const char* name, const char* key = nullptr, uint64_t value = 0) {
+        auto& buf = buffer();
+        if (key != nullptr) {
+            auto it = buf.keys.find(key);
+            if (it == buf.keys.end()) {
+                it = buf.keys.emplace(key, intern(key)).first;
+            }
+            key = it->second;
+        }
+        std::lock_guard<std::mutex> lock(buf.mutex);
+        if (buf.events.size() >= max_events_per_thread) {
+            buf.open.push_back(max_events_per_thread);
+            buf.dropped++;
+            return;
+        }
+        buf.open.push_back(buf.events.size());
+        buf.events.push_back({name, key, value, now_ns(), 0});
+    }
+
+    void end() {
+        auto& buf = buffer();
+        std::lock_guard<std::mutex> lock(buf.mutex);
+        if (buf.open.empty()) {
+            return;
+        }
+        const auto idx = buf.open.back();
+        buf.open.pop_back();
+        if (idx < buf.events.size()) {
+            buf.events[idx].end_ns = now_ns();
+        }
+    }
+
+    void set_thread_name(const char* name) {
+        auto& buf = buffer();
+        std::lock_guard<std::mutex> lock(buf.mutex);
+        buf.name = name;
+    }
+
+    void dump() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_dumped) {
+            return;
+        }
+        m_dumped = true;
+        std::ofstream out(trace_file());
+        if (!out) {
+            return;
+        }
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        auto separator = [&] {
+            out << (first ? "\n" : ",\n");
+            first = false;
+        };
+        for (const auto& buf : m_buffers) {
+            std::lock_guard<std::mutex> buffer_lock(buf->mutex);
+            if (!buf->name.empty()) {
+                separator();
+                out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buf->tid
+                    << ",\"args\":{\"name\":\"";
+                write_escaped(out, buf->name);
+                out << "\"}}";
+            }
+            for (const auto& event : buf->events) {
+                if (event.end_ns == 0) {
+                    continue;
+                }
+                separator();
+                out << "{\"name\":\"";
+                write_escaped(out, event.name);
+                out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buf->tid
+                    << ",\"ts\":" << (event.begin_ns - m_start_ns) / 1000.0
+                    << ",\"dur\":" << (event.end_ns - event.begin_ns) / 1000.0;
+                if (event.key) {
+                    out << ",\"args\":{\"";
+                    write_escaped(out, event.key);
+                    out << "\":" << event.value << "}";
+                }
+                out << "}";
+            }
+            if (buf->dropped) {
+                separator();
+                out << "{\"name\":\"dropped events\",\"ph\":\"C\",\"pid\":1,\"tid\":" << buf->tid
+                    << ",\"ts\":0,\"args\":{\"count\":" << buf->dropped << "}}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+private:
+    Collector() = default;
+
+    std::mutex m_mutex;
+    std::unordered_set<std::string> m_names;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    const int64_t m_start_ns = now_ns();
+    bool m_dumped = false;
+};
+
+}  // namespace trace
+
 domain_t domain(const char* name) {
     if (name == nullptr) {
         return nullptr;
     }
+    if (trace::is_enabled()) {
+        return reinterpret_cast<domain_t>(const_cast<char*>(trace::Collector::get().intern(name)));
+    }
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
 
@@ -55,10 +249,19 @@ handle_t handle(const char* name) {
     if (name == nullptr) {
         return nullptr;
     }
+    if (trace::is_enabled()) {
+        return reinterpret_cast<handle_t>(const_cast<char*>(trace::Collector::get().intern(name)));
+    }
     return reinterpret_cast<handle_t>(__itt_string_handle_create(name));
 }
 
 void taskBegin(domain_t d, handle_t t) {
+    if (trace::is_enabled()) {
+        if (d != nullptr && t != nullptr) {
+            trace::Collector::get().begin(reinterpret_cast<const char*>(t));
+        }
+        return;
+    }
     if (!is_initialized() || d == nullptr || t == nullptr) {
         return;
     }
@@ -73,6 +276,12 @@ void taskBegin(domain_t d, handle_t t) {
 }
 
 void taskBegin(domain_t d, handle_t t, const char* key, uint64_t value) {
+    if (trace::is_enabled()) {
+        if (d != nullptr && t != nullptr && key != nullptr) {
+            trace::Collector::get().begin(reinterpret_cast<const char*>(t), key, value);
+        }
+        return;
+    }
     if (!is_initialized() || d == nullptr || t == nullptr || key == nullptr) {
         return;
     }
@@ -93,6 +302,12 @@ void taskBegin(domain_t d, handle_t t, const char* key, uint64_t value) {
 }
 
 void taskEnd(domain_t d) {
+    if (trace::is_enabled()) {
+        if (d != nullptr) {
+            trace::Collector::get().end();
+        }
+        return;
+    }
     if (!is_initialized() || d == nullptr) {
         return;
     }
@@ -101,6 +316,12 @@ void taskEnd(domain_t d) {
 }
 
 void threadName(const char* name) {
+    if (trace::is_enabled()) {
+        if (name != nullptr) {
+            trace::Collector::get().set_thread_name(name);
+        }
+        return;
+    }
     if (!is_initialized()) {
         return;
     }
@@ -108,6 +329,10 @@ void threadName(const char* name) {
 }
 
 void regionBegin(domain_t d, handle_t t) {
+    if (trace::is_enabled()) {
+        taskBegin(d, t);
+        return;
+    }
     if (!is_initialized() || d == nullptr || t == nullptr) {
         return;
     }
@@ -123,6 +348,10 @@ void regionBegin(domain_t d, handle_t t) {
 }
 
 void regionBegin(domain_t d, handle_t t, const char* key, uint64_t value) {
+    if (trace::is_enabled()) {
+        taskBegin(d, t, key, value);
+        return;
+    }
     if (!is_initialized() || d == nullptr || t == nullptr || key == nullptr) {
         return;
     }
@@ -143,6 +372,10 @@ void regionBegin(domain_t d, handle_t t, const char* key, uint64_t value) {
 }
 
 void regionEnd(domain_t d) {
+    if (trace::is_enabled()) {
+        taskEnd(d);
+        return;
+    }
     if (!is_initialized() || d == nullptr) {
         return;
     }
@@ -157,6 +390,10 @@ void regionEnd(domain_t d) {
 }
 
 void shutdown() {
+    if (trace::is_enabled()) {
+        trace::Collector::get().dump();
+        return;
+    }
     __itt_release_resources();
 }
 
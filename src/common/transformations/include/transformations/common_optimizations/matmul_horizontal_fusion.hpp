@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API MatMulHorizontalFusion;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief MatMulHorizontalFusion transformation merges MatMuls which share the first input and have constant 2D weights
+ * with equal transpose attributes and element type into a single MatMul. The weights are concatenated along
+ * the output channels and the result is split back by a VariadicSplit over the last axis:
+ *
+ *              A                                A    Concat(B0, B1, ..., Bn)
+ *       /      |      \                         |    |
+ *  MatMul(B0) ...  MatMul(Bn)      =>           MatMul
+ *                                                 |
+ *                                           VariadicSplit(-1)
+ *                                          /      |      \
+ *
+ * The MatMuls are fused in the order of their friendly names. Decompressed weights (a Convert or Multiply over
+ * a low precision Constant) are not fused.
+ */
+class ov::pass::MatMulHorizontalFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("MatMulHorizontalFusion");
+    MatMulHorizontalFusion();
+};
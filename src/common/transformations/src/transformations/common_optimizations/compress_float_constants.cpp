@@ -8,6 +8,7 @@
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/fake_convert.hpp"
@@ -295,6 +296,8 @@ CompressFloatConstantsImpl::CompressFloatConstantsImpl(bool postponed) {
                 }
             } else {
                 ov::replace_node(const_node, convert);
+                // the fp32 source is no longer referenced by the model, let a file-backed buffer drop its pages
+                ov::wsh::Extension::hint_evict(*const_node);
             }
         }
         return true;
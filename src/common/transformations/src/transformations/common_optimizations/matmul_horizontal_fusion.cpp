@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "itt.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/variadic_split.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+namespace v0 = ov::op::v0;
+namespace v1 = ov::op::v1;
+
+namespace ov::pass {
+
+MatMulHorizontalFusion::MatMulHorizontalFusion() {
+    MATCHER_SCOPE(MatMulHorizontalFusion);
+    auto input_m = pattern::any_input(pattern::consumers_more_than(1));
+    auto weights_m = pattern::wrap_type<v0::Constant>(pattern::rank_equals(2));
+    auto matmul_m = pattern::wrap_type<v0::MatMul>({input_m, weights_m});
+
+    ov::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto& input = pattern_map.at(input_m);
+        const auto matmul = ov::as_type_ptr<v0::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        if (matmul->get_transpose_a() || transformation_callback(matmul)) {
+            return false;
+        }
+        const auto transpose_b = matmul->get_transpose_b();
+        const auto& ref_weights = matmul->get_input_node_shared_ptr(1);
+        // the output channels are the last axis of the MatMul result, so they are the rows of the transposed weights
+        const size_t n_axis = transpose_b ? 0 : 1;
+        const size_t k_axis = 1 - n_axis;
+        const auto k = ref_weights->get_shape()[k_axis];
+
+        std::vector<std::shared_ptr<v0::MatMul>> matmuls;
+        for (const auto& in : input.get_target_inputs()) {
+            const auto cur = ov::as_type_ptr<v0::MatMul>(in.get_node()->shared_from_this());
+            if (!cur || in.get_index() != 0 || cur->get_transpose_a() || cur->get_transpose_b() != transpose_b ||
+                cur->get_output_element_type(0) != matmul->get_output_element_type(0)) {
+                continue;
+            }
+            // decompressed weights (Convert/Multiply over a low precision Constant) are not merged: the scales and
+            // zero points would have to be concatenated as well, so only plain constants are fused
+            const auto weights = ov::as_type_ptr<v0::Constant>(cur->get_input_node_shared_ptr(1));
+            if (!weights || weights->get_shape().size() != 2 || weights->get_shape()[k_axis] != k ||
+                weights->get_element_type() != ref_weights->get_element_type()) {
+                continue;
+            }
+            matmuls.push_back(cur);
+        }
+        if (matmuls.size() < 2) {
+            return false;
+        }
+        // the target inputs come in pointer order, sort them so the fused layout doesn't change between runs
+        std::sort(matmuls.begin(),
+                  matmuls.end(),
+                  [](const std::shared_ptr<v0::MatMul>& a, const std::shared_ptr<v0::MatMul>& b) {
+                      return a->get_friendly_name() < b->get_friendly_name();
+                  });
+
+        OutputVector weights;
+        std::vector<int64_t> split_lengths;
+        for (const auto& cur : matmuls) {
+            weights.push_back(cur->input_value(1));
+            split_lengths.push_back(static_cast<int64_t>(cur->get_input_shape(1)[n_axis]));
+        }
+        const auto fused_weights =
+            ov::util::get_constant_from_source(std::make_shared<v0::Concat>(weights, static_cast<int64_t>(n_axis)));
+        if (!fused_weights) {
+            return false;
+        }
+        const auto fused_matmul = std::make_shared<v0::MatMul>(input, fused_weights, false, transpose_b);
+        const auto split =
+            std::make_shared<v1::VariadicSplit>(fused_matmul,
+                                                v0::Constant::create(element::i64, Shape{}, {-1}),
+                                                v0::Constant::create(element::i64, Shape{split_lengths.size()},
+                                                                     split_lengths));
+
+        NodeVector from;
+        for (size_t i = 0; i < matmuls.size(); ++i) {
+            from.push_back(matmuls[i]);
+            from.push_back(matmuls[i]->get_input_node_shared_ptr(1));
+            matmuls[i]->output(0).replace(split->output(i));
+        }
+        const auto& name = matmuls.front()->get_friendly_name();
+        fused_weights->set_friendly_name(name + "/fused_weights");
+        fused_matmul->set_friendly_name(name + "/fused");
+        split->set_friendly_name(name + "/split");
+        ov::copy_runtime_info(from, {fused_weights, fused_matmul, split});
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(matmul_m, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::pass
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/variadic_split.hpp"
+
+using namespace ov;
+using namespace testing;
+
+namespace v0 = ov::op::v0;
+namespace v1 = ov::op::v1;
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusion) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, 8});
+        auto weights_0 = v0::Constant::create(element::f32, Shape{4, 8}, {1});
+        auto weights_1 = v0::Constant::create(element::f32, Shape{6, 8}, {2});
+        auto mm_0 = std::make_shared<v0::MatMul>(input, weights_0, false, true);
+        auto mm_1 = std::make_shared<v0::MatMul>(input, weights_1, false, true);
+        auto relu_0 = std::make_shared<v0::Relu>(mm_0);
+        auto relu_1 = std::make_shared<v0::Relu>(mm_1);
+        model = std::make_shared<Model>(OutputVector{relu_0, relu_1}, ParameterVector{input});
+        manager.register_pass<pass::MatMulHorizontalFusion>();
+    }
+    {
+        std::vector<float> weights(4 * 8, 1.f);
+        weights.resize(10 * 8, 2.f);
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, 8});
+        auto fused_weights = v0::Constant::create(element::f32, Shape{10, 8}, weights);
+        auto mm = std::make_shared<v0::MatMul>(input, fused_weights, false, true);
+        auto split = std::make_shared<v1::VariadicSplit>(mm,
+                                                         v0::Constant::create(element::i64, Shape{}, {-1}),
+                                                         v0::Constant::create(element::i64, Shape{2}, {4, 6}));
+        auto relu_0 = std::make_shared<v0::Relu>(split->output(0));
+        auto relu_1 = std::make_shared<v0::Relu>(split->output(1));
+        model_ref = std::make_shared<Model>(OutputVector{relu_0, relu_1}, ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusionDifferentTranspose) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 8});
+        auto weights_0 = v0::Constant::create(element::f32, Shape{4, 8}, {1});
+        auto weights_1 = v0::Constant::create(element::f32, Shape{8, 6}, {2});
+        auto mm_0 = std::make_shared<v0::MatMul>(input, weights_0, false, true);
+        auto mm_1 = std::make_shared<v0::MatMul>(input, weights_1);
+        model = std::make_shared<Model>(OutputVector{mm_0, mm_1}, ParameterVector{input});
+        manager.register_pass<pass::MatMulHorizontalFusion>();
+    }
+}
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusionSortedByName) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 8});
+        auto weights_0 = v0::Constant::create(element::f32, Shape{4, 8}, {1});
+        auto weights_1 = v0::Constant::create(element::f32, Shape{6, 8}, {2});
+        auto mm_0 = std::make_shared<v0::MatMul>(input, weights_0, false, true);
+        auto mm_1 = std::make_shared<v0::MatMul>(input, weights_1, false, true);
+        mm_0->set_friendly_name("mm_b");
+        mm_1->set_friendly_name("mm_a");
+        model = std::make_shared<Model>(OutputVector{mm_0, mm_1}, ParameterVector{input});
+        manager.register_pass<pass::MatMulHorizontalFusion>();
+    }
+    {
+        std::vector<float> weights(6 * 8, 2.f);
+        weights.resize(10 * 8, 1.f);
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 8});
+        auto fused_weights = v0::Constant::create(element::f32, Shape{10, 8}, weights);
+        auto mm = std::make_shared<v0::MatMul>(input, fused_weights, false, true);
+        auto split = std::make_shared<v1::VariadicSplit>(mm,
+                                                         v0::Constant::create(element::i64, Shape{}, {-1}),
+                                                         v0::Constant::create(element::i64, Shape{2}, {6, 4}));
+        model_ref = std::make_shared<Model>(OutputVector{split->output(1), split->output(0)}, ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusionDecompressedWeights) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 8});
+        auto weights_0 = v0::Constant::create(element::u8, Shape{4, 8}, {1});
+        auto weights_1 = v0::Constant::create(element::u8, Shape{6, 8}, {2});
+        auto convert_0 = std::make_shared<v0::Convert>(weights_0, element::f32);
+        auto convert_1 = std::make_shared<v0::Convert>(weights_1, element::f32);
+        auto mm_0 = std::make_shared<v0::MatMul>(input, convert_0, false, true);
+        auto mm_1 = std::make_shared<v0::MatMul>(input, convert_1, false, true);
+        model = std::make_shared<Model>(OutputVector{mm_0, mm_1}, ParameterVector{input});
+        manager.register_pass<pass::MatMulHorizontalFusion>();
+    }
+}
@@ -84,4 +84,17 @@ FileHandle open_file_for_read(const std::filesystem::path& path);
  * @return true if all bytes were read successfully, false on I/O error.
  */
 bool positional_read(FileHandle handle, char* dst, size_t size, size_t file_offset);
+
+/**
+ * @brief Hint the OS that a file range will be read sequentially soon.
+ *
+ * On Linux, uses posix_fadvise(POSIX_FADV_SEQUENTIAL) followed by POSIX_FADV_WILLNEED,
+ * which enlarges the readahead window of the handle and starts the page-in asynchronously.
+ * On Windows, this is a no-op.
+ *
+ * @param handle       File handle / descriptor.
+ * @param size         Number of bytes that will be read.
+ * @param file_offset  Absolute byte offset in the file.
+ */
+void advise_sequential_read(FileHandle handle, size_t size, size_t file_offset);
 }  // namespace ov::util
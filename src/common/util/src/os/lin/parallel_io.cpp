@@ -66,4 +66,12 @@ bool positional_read(FileHandle handle, char* dst, size_t size, size_t file_offs
     return true;
 }
 
+void advise_sequential_read(FileHandle handle, size_t size, size_t file_offset) {
+    const auto offset = static_cast<off_t>(file_offset);
+    const auto length = static_cast<off_t>(size);
+    // Advisory only, the read itself reports any real I/O error
+    (void)::posix_fadvise(handle, offset, length, POSIX_FADV_SEQUENTIAL);
+    (void)::posix_fadvise(handle, offset, length, POSIX_FADV_WILLNEED);
+}
+
 }  // namespace ov::util
@@ -89,4 +89,6 @@ bool positional_read(FileHandle handle, char* dst, size_t size, size_t file_offs
     return true;
 }
 
+void advise_sequential_read(FileHandle, size_t, size_t) {}
+
 }  // namespace ov::util
\ No newline at end of file
@@ -317,6 +317,7 @@ bool ParallelReadStreamBuf::parallel_read(char* dst, size_t size, size_t file_of
                     return;
                 }
 
+                advise_sequential_read(t_handle, read_size, thread_file_offset);
                 if (!positional_read(t_handle, ptr, read_size, thread_file_offset)) {
                     success = false;
                 }
@@ -21,7 +21,9 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true);
+    /// @param alignment  Data of at least this size is written at the offsets aligned to it, so the constants of
+    ///                   a memory mapped blob are aligned as well. Smaller data is written without padding.
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, size_t alignment = 1);
     virtual ~ConstantWriter();
 
     virtual FilePosition write(const char* ptr,
@@ -37,6 +39,10 @@ public:
         return m_data_hash;
     }
 
+protected:
+    /// @brief Computes the content hash of the data written as is (not compressed to fp16) with enabled compression
+    virtual HashValue compute_data_hash(const char* ptr, size_t size);
+
 private:
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
@@ -47,6 +53,7 @@ private:
     std::vector<std::vector<char>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
+    size_t m_alignment;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
 };
@@ -335,6 +335,18 @@ void save_model(const std::shared_ptr<const ov::Model>& model,
                 bool compress_to_fp16 = true);
 #endif
 
+/// \brief Save given model into IR as ov::save_model above does, the weights are written aligned.
+/// \param model Model which will be converted to IR representation.
+/// \param output_model Path to the output model file, must have extension .xml.
+/// \param compress_to_fp16 Whether to compress floating point weights to FP16.
+/// \param weights_alignment The constants of at least this size are written at the offsets of the .bin file aligned to
+/// it, e.g. 4096 lets a memory mapped model provide page aligned constants without a copy.
+OPENVINO_API
+void save_model(const std::shared_ptr<const ov::Model>& model,
+                const std::filesystem::path& output_model,
+                bool compress_to_fp16,
+                size_t weights_alignment);
+
 /// \}
 
 }  // namespace ov
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -20,6 +23,21 @@ namespace pass {
  */
 class OPENVINO_API Manager {
 public:
+    /// \brief Aggregated execution statistics of a single pass collected by run_passes
+    /// when statistics collection is enabled with set_collect_statistics.
+    struct PassStatistics {
+        /// \brief Name of the pass
+        std::string name;
+        /// \brief Total wall time spent in the pass
+        std::chrono::nanoseconds time{0};
+        /// \brief Number of times the pass was run
+        size_t invocations = 0;
+        /// \brief Number of runs which changed the model
+        size_t applied = 0;
+        /// \brief Total change of the number of nodes in the model made by the pass
+        int64_t node_count_delta = 0;
+    };
+
     Manager();
     virtual ~Manager();
 
@@ -80,6 +98,17 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable collection of per pass execution statistics
+    /// in run_passes. Counting nodes requires a model traversal after each pass, so
+    /// the collection is disabled by default.
+    /// \param new_state Value "true" enables statistics collection; "false", otherwise
+    void set_collect_statistics(bool new_state);
+
+    /// \return Statistics of the passes executed by run_passes since collection was enabled,
+    /// one entry per pass name in the order of the first execution. The statistics belong to
+    /// this manager instance, they are not copied with the manager.
+    const std::vector<PassStatistics>& get_statistics() const;
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -46,6 +46,18 @@ public:
               const std::filesystem::path& bin_path,
               Version version = Version::UNSPECIFIED);
 
+    /**
+     * @param weights_alignment  The constants of at least this size are written at the offsets of the bin file aligned
+     *                           to it (e.g. 4096 for the page aligned constants of a memory mapped model). The value 1,
+     *                           used by the constructors above, writes the constants without any padding.
+     */
+    Serialize(std::ostream& xml_file, std::ostream& bin_file, Version version, size_t weights_alignment);
+
+    Serialize(const std::filesystem::path& xml_path,
+              const std::filesystem::path& bin_path,
+              Version version,
+              size_t weights_alignment);
+
 private:
     std::ostream* m_xml_file;
     std::ostream* m_bin_file;
@@ -53,6 +65,7 @@ private:
     const std::filesystem::path m_bin_path;
     const Version m_version;
     const std::map<std::string, ov::OpSet> m_custom_opsets;
+    const size_t m_weights_alignment;
 };
 
 /**
@@ -349,6 +349,13 @@ void serialize(const std::shared_ptr<const ov::Model>& m,
 void save_model(const std::shared_ptr<const ov::Model>& m,
                 const std::filesystem::path& output_model,
                 bool compress_to_fp16) {
+    save_model(m, output_model, compress_to_fp16, 1);
+}
+
+void save_model(const std::shared_ptr<const ov::Model>& m,
+                const std::filesystem::path& output_model,
+                bool compress_to_fp16,
+                size_t weights_alignment) {
     auto cloned = m->clone();
     const auto& [build_number, description] = ov::get_openvino_version();
     cloned->set_rt_info(build_number, description);
@@ -361,7 +368,10 @@ void save_model(const std::shared_ptr<const ov::Model>& m,
 
     ov::pass::Manager manager("SaveModel");
     manager.register_pass<ov::pass::FusedNamesCleanup>();
-    manager.register_pass<ov::pass::Serialize>(output_model, "");
+    manager.register_pass<ov::pass::Serialize>(output_model,
+                                               "",
+                                               ov::pass::Serialize::Version::UNSPECIFIED,
+                                               weights_alignment);
     manager.run_passes(std::move(cloned));
 }
 
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "evaluator.hpp"
 #include "itt.hpp"
@@ -34,10 +35,10 @@ void check_all_variables_registered(const std::vector<shared_ptr<ov::Node>>& ord
                                     const ov::op::util::VariableVector& variables) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_pass, "Model::check_all_variables_registered");
     std::stringstream unregistered_variables;
+    const std::unordered_set<ov::op::util::Variable::Ptr> registered(variables.begin(), variables.end());
     for (auto& node : ordered_ops) {
-        const auto& variable_op = dynamic_pointer_cast<ov::op::util::VariableExtension>(node);
-        if (variable_op &&
-            std::find(variables.begin(), variables.end(), variable_op->get_variable()) == variables.end())
+        const auto variable_op = dynamic_cast<const ov::op::util::VariableExtension*>(node.get());
+        if (variable_op && registered.count(variable_op->get_variable()) == 0)
             unregistered_variables << variable_op->get_variable_id() << std::endl;
     }
     OPENVINO_ASSERT(unregistered_variables.str().empty(),
@@ -50,9 +51,12 @@ void check_all_parameters_registered(const std::vector<shared_ptr<ov::Node>>& or
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "Model::check_all_parameters_registered");
 
     std::stringstream unregistered_parameters;
+    std::unordered_set<const ov::Node*> registered;
+    registered.reserve(parameters.size());
+    for (const auto& parameter : parameters)
+        registered.insert(parameter.get());
     for (auto& node : ordered_ops) {
-        if (ov::op::util::is_parameter(node) &&
-            std::find(parameters.begin(), parameters.end(), node) == parameters.end())
+        if (ov::op::util::is_parameter(node) && registered.count(node.get()) == 0)
             unregistered_parameters << node << std::endl;
     }
     OPENVINO_ASSERT(unregistered_parameters.str().empty(),
@@ -240,24 +244,19 @@ void ov::Model::validate_nodes_and_infer_types() const {
 
     std::stringstream unregistered_parameters;
     std::stringstream unregistered_variables;
-    std::unordered_set<const ov::descriptor::Tensor*> tensors;
+    std::unordered_set<const ov::Node*> parameters;
+    parameters.reserve(m_parameters.size());
+    for (const auto& parameter : m_parameters)
+        parameters.insert(parameter.get());
+    const std::unordered_set<op::util::Variable::Ptr> variables(m_variables.begin(), m_variables.end());
 
     for (auto& node : get_ordered_ops()) {
         node->revalidate_and_infer_types();
-        for (const auto& output : node->outputs()) {
-            const auto& tensor = output.get_tensor();
-            // Skip results outputs tensors because result_input_tensor == result_output_tensor
-            if (tensors.count(&tensor))
-                continue;
-            tensors.insert(&tensor);
-        }
-        if (op::util::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
+        if (op::util::is_parameter(node) && parameters.count(node.get()) == 0)
             unregistered_parameters << node << std::endl;
 
-        const auto& variable_op = dynamic_pointer_cast<op::util::VariableExtension>(node);
-        if (variable_op &&
-            std::find(m_variables.begin(), m_variables.end(), variable_op->get_variable()) == m_variables.end())
+        const auto variable_op = dynamic_cast<const op::util::VariableExtension*>(node.get());
+        if (variable_op && variables.count(variable_op->get_variable()) == 0)
             unregistered_variables << variable_op->get_variable_id() << std::endl;
     }
 
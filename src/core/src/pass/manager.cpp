@@ -314,11 +314,49 @@ private:
     std::fstream m_file;
 };
 
+/**
+ * @brief The per pass statistics of the managers, which collect them. They are kept aside, so the collection doesn't
+ * change the layout of the exported pass::Manager class.
+ */
+class StatisticsRegistry {
+public:
+    using Statistics = std::vector<ov::pass::Manager::PassStatistics>;
+
+    static StatisticsRegistry& get() {
+        // never destroyed, so the managers destroyed at the program exit find it alive
+        static auto* registry = new StatisticsRegistry();
+        return *registry;
+    }
+
+    void enable(const ov::pass::Manager* manager, bool new_state) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (new_state) {
+            m_statistics[manager].clear();
+        } else {
+            m_statistics.erase(manager);
+        }
+    }
+
+    /// \return The statistics of the manager or nullptr, if the manager doesn't collect them. The references to the
+    /// elements of the map stay valid on the insertion of the other managers.
+    Statistics* find(const ov::pass::Manager* manager) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto it = m_statistics.find(manager);
+        return it == m_statistics.end() ? nullptr : &it->second;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<const ov::pass::Manager*, Statistics> m_statistics;
+};
+
 }  // namespace
 
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()) {}
 
-ov::pass::Manager::~Manager() = default;
+ov::pass::Manager::~Manager() {
+    StatisticsRegistry::get().enable(this, false);
+}
 
 ov::pass::Manager::Manager(std::string name) : m_pass_config(std::make_shared<PassConfig>()), m_name(std::move(name)) {}
 
@@ -333,6 +371,16 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_collect_statistics(bool new_state) {
+    StatisticsRegistry::get().enable(this, new_state);
+}
+
+const std::vector<ov::pass::Manager::PassStatistics>& ov::pass::Manager::get_statistics() const {
+    static const StatisticsRegistry::Statistics empty;
+    const auto statistics = StatisticsRegistry::get().find(this);
+    return statistics ? *statistics : empty;
+}
+
 bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "pass::Manager::run_passes");
     Profiler profiler(m_name);
@@ -340,6 +388,15 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     bool manager_changed_model = false;
     bool needs_validation = false;
 
+    const auto statistics = StatisticsRegistry::get().find(this);
+    std::unordered_map<std::string, size_t> statistics_idx;
+    for (size_t i = 0; statistics && i < statistics->size(); ++i) {
+        statistics_idx.emplace((*statistics)[i].name, i);
+    }
+    const auto count_nodes = [&model]() {
+        return static_cast<int64_t>(model->get_ordered_ops().size());
+    };
+
     profiler.start_timer(m_name);
     for (const auto& pass : m_pass_list) {
         if (needs_validation) {
@@ -365,10 +422,27 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
 
         const auto& pass_name = pass->get_name();
 
+        const auto nodes_before = statistics ? count_nodes() : 0;
+        const auto start_time = std::chrono::steady_clock::now();
         profiler.start_timer(pass_name);
         bool pass_changed_model = run_pass(pass, model);
         profiler.stop_timer(pass_name, pass_changed_model);
 
+        if (statistics) {
+            const auto elapsed = std::chrono::steady_clock::now() - start_time;
+            const auto idx = statistics_idx.emplace(pass_name, statistics->size());
+            if (idx.second) {
+                statistics->push_back({pass_name});
+            }
+            auto& stats = (*statistics)[idx.first->second];
+            stats.time += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+            stats.invocations++;
+            if (pass_changed_model) {
+                stats.applied++;
+                stats.node_count_delta += count_nodes() - nodes_before;
+            }
+        }
+
         manager_changed_model = manager_changed_model || pass_changed_model;
         needs_validation = (ov::as_type_ptr<ov::pass::Validate>(pass)) ? false : needs_validation || pass_changed_model;
 
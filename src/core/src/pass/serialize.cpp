@@ -4,9 +4,11 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <fstream>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -17,6 +19,8 @@
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
@@ -91,9 +95,9 @@ void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
                     ov::pass::Serialize::Version ver,
-                    bool deterministic = false) {
-    ov::util::ConstantWriter constant_write_handler(bin_file);
-    serialize_func(xml_file, bin_file, std::move(model), ver, deterministic, constant_write_handler);
+                    size_t weights_alignment) {
+    ov::util::ConstantWriter constant_write_handler(bin_file, true, weights_alignment);
+    serialize_func(xml_file, bin_file, std::move(model), ver, false, constant_write_handler);
 }
 
 void handle_file_serialize_error(const std::filesystem::path& xml_path,
@@ -116,7 +120,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     convert_py_rt_info(model);
 
     if (m_xml_file && m_bin_file) {
-        serialize_func(*m_xml_file, *m_bin_file, model, m_version);
+        serialize_func(*m_xml_file, *m_bin_file, model, m_version, m_weights_alignment);
     } else {
         ov::util::create_directory_recursive(m_xml_path.parent_path());
 
@@ -130,7 +134,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         xml_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            serialize_func(xml_file, bin_file, model, m_version, m_weights_alignment);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -148,20 +152,34 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
 }
 
 pass::Serialize::Serialize(std::ostream& xml_file, std::ostream& bin_file, pass::Serialize::Version version)
+    : Serialize(xml_file, bin_file, version, 1) {}
+
+pass::Serialize::Serialize(const std::filesystem::path& xml_path,
+                           const std::filesystem::path& bin_path,
+                           Version version)
+    : Serialize(xml_path, bin_path, version, 1) {}
+
+pass::Serialize::Serialize(std::ostream& xml_file,
+                           std::ostream& bin_file,
+                           pass::Serialize::Version version,
+                           size_t weights_alignment)
     : m_xml_file{&xml_file},
       m_bin_file{&bin_file},
       m_xml_path{},
       m_bin_path{},
-      m_version{version} {}
+      m_version{version},
+      m_weights_alignment{weights_alignment} {}
 
 pass::Serialize::Serialize(const std::filesystem::path& xml_path,
                            const std::filesystem::path& bin_path,
-                           Version version)
+                           Version version,
+                           size_t weights_alignment)
     : m_xml_file{nullptr},
       m_bin_file{nullptr},
       m_xml_path{xml_path},
       m_bin_path{bin_path.empty() ? provide_bin_path(xml_path) : bin_path},
-      m_version{version} {
+      m_version{version},
+      m_weights_alignment{weights_alignment} {
     validate_xml_path(m_xml_path);
 }
 
@@ -303,6 +321,95 @@ public:
         return n;
     }
 };
+
+// Collects the buffers of the constants loaded from a weights file (the ones carrying a weight sharing descriptor).
+// Such buffers are read-only, so their content hash may be reused for as long as the buffer object is alive.
+class SharedWeightsCollector final : public ov::AttributeVisitor {
+    std::unordered_map<const void*, std::shared_ptr<ov::AlignedBuffer>>& m_buffers;
+
+public:
+    explicit SharedWeightsCollector(std::unordered_map<const void*, std::shared_ptr<ov::AlignedBuffer>>& buffers)
+        : m_buffers(buffers) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            if (name == "value" && buffer && buffer->get_descriptor()) {
+                m_buffers.emplace(static_cast<const AlignedBuffer&>(*buffer).get_ptr(), buffer);
+            }
+        }
+    }
+
+    void on_adapter(const std::string&, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        collect(*adapter.get());
+    }
+
+    void collect(const ov::Model& model) {
+        for (const auto& op : model.get_ordered_ops()) {
+            if (ov::is_type<ov::op::v0::Constant>(op) || ov::is_type<ov::op::util::MultiSubGraphOp>(op)) {
+                op->visit_attributes(*this);
+            }
+        }
+    }
+};
+
+// Memoizes the content hashes of the shared weights between the Hash pass runs, so the repeated cache key
+// calculation for the same in-memory model is proportional to the graph size rather than to the weights size
+class MemoizedHashConstantWriter final : public util::ConstantWriter {
+public:
+    MemoizedHashConstantWriter(std::ostream& bin_data, const ov::Model& model) : util::ConstantWriter(bin_data) {
+        SharedWeightsCollector{m_buffers}.collect(model);
+    }
+
+protected:
+    HashValue compute_data_hash(const char* ptr, size_t size) override {
+        const auto buffer_it = m_buffers.find(ptr);
+        if (buffer_it == m_buffers.end() || buffer_it->second->size() != size) {
+            return util::ConstantWriter::compute_data_hash(ptr, size);
+        }
+        const auto& buffer = buffer_it->second;
+
+        auto& memo = get_memo();
+        {
+            std::lock_guard<std::mutex> lock(memo.mutex);
+            auto it = memo.hashes.find(buffer.get());
+            if (it != memo.hashes.end()) {
+                if (it->second.first.lock() == buffer) {
+                    return it->second.second;
+                }
+                // the buffer object was released and its address has been reused
+                memo.hashes.erase(it);
+            }
+        }
+
+        const auto hash = util::ConstantWriter::compute_data_hash(ptr, size);
+        std::lock_guard<std::mutex> lock(memo.mutex);
+        // drop the released buffers once the memo has doubled since the last sweep, so inserts stay amortized O(1)
+        if (memo.hashes.size() >= memo.sweep_size) {
+            for (auto it = memo.hashes.begin(); it != memo.hashes.end();) {
+                it = it->second.first.expired() ? memo.hashes.erase(it) : std::next(it);
+            }
+            memo.sweep_size = std::max(Memo::min_sweep_size, 2 * memo.hashes.size());
+        }
+        memo.hashes.emplace(buffer.get(), std::make_pair(std::weak_ptr<ov::AlignedBuffer>(buffer), hash));
+        return hash;
+    }
+
+private:
+    struct Memo {
+        static constexpr size_t min_sweep_size = 64;
+        std::mutex mutex;
+        size_t sweep_size = min_sweep_size;
+        std::unordered_map<const ov::AlignedBuffer*, std::pair<std::weak_ptr<ov::AlignedBuffer>, HashValue>> hashes;
+    };
+
+    static Memo& get_memo() {
+        static Memo memo;
+        return memo;
+    }
+
+    std::unordered_map<const void*, std::shared_ptr<ov::AlignedBuffer>> m_buffers;
+};
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
@@ -314,11 +421,16 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
 
     // Determinism is important for hash calculation
     // If skip weights set, disable compression to skip internal data hashing
-    auto constant_writer = util::ConstantWriter(bin, !m_skip_weights);
-    serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
+    std::unique_ptr<util::ConstantWriter> constant_writer;
+    if (m_skip_weights) {
+        constant_writer = std::make_unique<util::ConstantWriter>(bin, false);
+    } else {
+        constant_writer = std::make_unique<MemoizedHashConstantWriter>(bin, *model);
+    }
+    serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, *constant_writer);
 
     auto seed = util::u64_hash_combine(0, xml_hash.get_result());
-    m_hash = util::u64_hash_combine(seed, constant_writer.get_data_hash());
+    m_hash = util::u64_hash_combine(seed, constant_writer->get_data_hash());
     // Return false because we didn't change OpenVINO Model
     return false;
 }
@@ -8,9 +8,8 @@
 
 namespace {
 
-std::unordered_map<std::string, std::vector<ov::Any>> get_copyable_attrs(const ov::OutputVector& outputs,
-                                                                         const ov::Output<ov::Node>& to) {
-    std::unordered_map<std::string, std::vector<ov::Any>> attrs;
+template <typename F>
+void for_each_copyable_attr(const ov::OutputVector& outputs, const ov::Output<ov::Node>& to, F&& func) {
     for (const auto& output : outputs) {
         for (const auto& item : output.get_rt_info()) {
             bool copy = true;
@@ -18,16 +17,14 @@ std::unordered_map<std::string, std::vector<ov::Any>> get_copyable_attrs(const o
                 copy = item.second.as<ov::RuntimeAttribute>().is_copyable(to.get_node_shared_ptr());
             }
             if (copy) {
-                attrs[item.first].push_back(item.second);
+                func(item);
             }
         }
     }
-    return attrs;
 }
 
-std::unordered_map<std::string, std::vector<ov::Any>> get_copyable_attrs(const ov::NodeVector& nodes,
-                                                                         const std::shared_ptr<ov::Node>& to) {
-    std::unordered_map<std::string, std::vector<ov::Any>> attrs;
+template <typename F>
+void for_each_copyable_attr(const ov::NodeVector& nodes, const std::shared_ptr<ov::Node>& to, F&& func) {
     for (const auto& node : nodes) {
         for (const auto& item : node->get_rt_info()) {
             bool copy = item.first != "opset";
@@ -35,18 +32,28 @@ std::unordered_map<std::string, std::vector<ov::Any>> get_copyable_attrs(const o
                 copy = copy && item.second.as<ov::RuntimeAttribute>().is_copyable(to);
             }
             if (copy) {
-                attrs[item.first].push_back(item.second);
+                func(item);
             }
         }
     }
-    return attrs;
 }
 
 template <typename T>
 ov::Node::RTMap mergeRuntimeInfo(const std::vector<T>& items, const T& to) {
-    std::unordered_map<std::string, std::vector<ov::Any>> attrs = get_copyable_attrs(items, to);
-
     ov::Node::RTMap merged_attrs;
+    if (items.size() == 1) {
+        // a single source cannot produce conflicting attributes, so there is nothing to merge
+        for_each_copyable_attr(items, to, [&](const ov::Node::RTMap::value_type& item) {
+            merged_attrs.emplace_hint(merged_attrs.end(), item);
+        });
+        return merged_attrs;
+    }
+
+    std::unordered_map<std::string, std::vector<ov::Any>> attrs;
+    for_each_copyable_attr(items, to, [&](const ov::Node::RTMap::value_type& item) {
+        attrs[item.first].push_back(item.second);
+    });
+
     for (auto& item : attrs) {
         auto& attr = *item.second.begin();
         if (item.second.size() == 1) {
@@ -72,10 +79,13 @@ ov::Any get_opset(const ov::Node::RTMap& rt_info) {
     return nullptr;
 }
 
-void assign_runtime_info(const ov::Node::RTMap& from, ov::Node::RTMap& to) {
+void assign_runtime_info(ov::Node::RTMap&& from, ov::Node::RTMap& to) {
+    if (from.empty()) {
+        return;
+    }
     auto opset = get_opset(to);
     for (auto& item : from) {
-        to[item.first] = item.second;
+        to[item.first] = std::move(item.second);
     }
     if (!opset.empty()) {
         to["opset"] = std::move(opset);
@@ -11,10 +11,11 @@
 
 namespace ov::util {
 
-ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
+ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression, size_t alignment)
     : m_hash_to_file_positions{},
       m_binary_output(bin_data),
       m_enable_compression(enable_compression),
+      m_alignment(alignment),
       m_blob_offset(bin_data.tellp()),
       m_data_hash{} {}
 
@@ -26,19 +27,25 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    bool compress_to_fp16,
                                                    ov::element::Type src_type,
                                                    bool ptr_is_temporary) {
-    const FilePosition write_pos = m_binary_output.get().tellp();
-    const auto offset = write_pos - m_blob_offset;
     new_size = size;
 
     const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
     const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
 
+    // the padding is written right before the data, so nothing is written if a matching blob is found below
+    const FilePosition write_pos = m_binary_output.get().tellp();
+    const auto padding = m_alignment > 1 && new_size >= m_alignment
+                             ? (m_alignment - static_cast<size_t>(write_pos) % m_alignment) % m_alignment
+                             : 0;
+    const auto offset = write_pos + static_cast<FilePosition>(padding) - m_blob_offset;
+
     if (m_enable_compression) {
         // This hash is weak (but efficient). For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const HashValue hash =
+            compress_to_fp16 ? ov::runtime::compute_hash(data_ptr, new_size) : compute_data_hash(ptr, size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
@@ -57,6 +64,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // fast hash (skip data)
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
     }
+    if (padding) {
+        const std::vector<char> zeros(padding, 0);
+        m_binary_output.get().write(zeros.data(), zeros.size());
+    }
     m_binary_output.get().write(data_ptr, new_size);
     return offset;
 }
@@ -101,6 +112,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
     }
 }
 
+ConstantWriter::HashValue ConstantWriter::compute_data_hash(const char* ptr, size_t size) {
+    return ov::runtime::compute_hash(ptr, size);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               const element::Type& src_type,
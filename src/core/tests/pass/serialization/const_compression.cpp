@@ -56,6 +56,39 @@ TEST_F(SerializationConstantCompressionTest, IdenticalConstantsI32) {
     ASSERT_EQ(file_size(bin_1), unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
 
+TEST_F(SerializationConstantCompressionTest, LargeConstantsArePackedByDefault) {
+    const ov::Shape shape{4096 + 4};
+
+    auto A = ov::op::v0::Constant::create(ov::element::i8, shape, std::vector<int8_t>(shape[0], 1));
+    auto B = ov::op::v0::Constant::create(ov::element::i8, shape, std::vector<int8_t>(shape[0], 2));
+
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(model);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_EQ(file_size(bin_1), 2 * ov::shape_size(shape));
+}
+
+TEST_F(SerializationConstantCompressionTest, LargeConstantsArePageAligned) {
+    constexpr size_t page_size = 4096;
+    const ov::Shape shape{page_size + 4};
+
+    auto A = ov::op::v0::Constant::create(ov::element::i8, shape, std::vector<int8_t>(shape[0], 1));
+    auto B = ov::op::v0::Constant::create(ov::element::i8, shape, std::vector<int8_t>(shape[0], 2));
+
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{A, B}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1, ov::pass::Serialize::Version::UNSPECIFIED, page_size)
+        .run_on_model(model);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    // the second constant starts at the next page boundary
+    ASSERT_EQ(file_size(bin_1), 2 * page_size + ov::shape_size(shape));
+}
+
 TEST_F(SerializationConstantCompressionTest, IdenticalConstantsI64) {
     constexpr int unique_const_count = 1;
     const ov::Shape shape{2, 2, 2};
@@ -8,6 +8,7 @@
 
 #include <fstream>
 #include <iterator>
+#include <regex>
 
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
@@ -95,6 +96,32 @@ TEST_P(SerializePassTestP, serialize_simple_model_with_constant) {
     EXPECT_TRUE(is_valid) << error_msg;
 }
 
+TEST_F(SerializePassTest, save_model_with_aligned_weights) {
+    constexpr size_t alignment = 4096;
+    const Shape shape{alignment + 4};
+    const auto p1 = std::make_shared<Parameter>(element::i8, shape);
+    const auto c1 = std::make_shared<Constant>(element::i8, shape, std::vector<int8_t>(shape_size(shape), 1));
+    const auto c2 = std::make_shared<Constant>(element::i8, shape, std::vector<int8_t>(shape_size(shape), 2));
+    const auto add = std::make_shared<Add>(std::make_shared<Add>(p1, c1), c2);
+    m_model = std::make_shared<Model>(OutputVector{add}, ParameterVector{p1}, "aligned_weights");
+
+    OV_ASSERT_NO_THROW(save_model(m_model, m_out_xml_path, false, alignment));
+
+    std::ifstream xml(m_out_xml_path);
+    const std::string ir{std::istreambuf_iterator<char>(xml), std::istreambuf_iterator<char>()};
+    const std::regex offset_regex{R"(offset="(\d+)")"};
+    size_t offsets_count = 0;
+    for (auto it = std::sregex_iterator(ir.begin(), ir.end(), offset_regex); it != std::sregex_iterator(); ++it) {
+        EXPECT_EQ(std::stoull((*it)[1].str()) % alignment, 0);
+        offsets_count++;
+    }
+    EXPECT_EQ(offsets_count, 2);
+
+    const auto serialized_model = test::readModel(m_out_xml_path.string(), m_out_bin_path.string());
+    const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
+    EXPECT_TRUE(is_valid) << error_msg;
+}
+
 using SerializationParams = std::tuple<std::string, std::string>;
 
 class SerializationTest : public ov::test::TestsCommon, public testing::WithParamInterface<SerializationParams> {
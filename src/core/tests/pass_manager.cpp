@@ -349,6 +349,36 @@ TEST(pass_manager, Validate_counter_1) {
     EXPECT_EQ(manager.get_num_validate_executed(), /*no Validate inserted*/ 0);
 }
 
+TEST(pass_manager, Statistics_per_pass) {
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.set_collect_statistics(true);
+
+    auto graph = make_test_graph();
+
+    const auto pass_true = manager.register_pass<TestModelPassTrue>();
+    const auto pass_false = manager.register_pass<TestModelPassFalse>();
+    manager.register_pass<TestModelPassTrue>();
+
+    EXPECT_TRUE(manager.run_passes(graph));
+
+    const auto& stats = manager.get_statistics();
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_EQ(stats[0].name, pass_true->get_name());
+    EXPECT_EQ(stats[0].invocations, 2);
+    EXPECT_EQ(stats[0].applied, 2);
+    EXPECT_EQ(stats[0].node_count_delta, 0);
+    EXPECT_EQ(stats[1].name, pass_false->get_name());
+    EXPECT_EQ(stats[1].invocations, 1);
+    EXPECT_EQ(stats[1].applied, 0);
+
+    manager.run_passes(graph);
+    EXPECT_EQ(manager.get_statistics()[0].invocations, 4);
+
+    manager.set_collect_statistics(false);
+    EXPECT_TRUE(manager.get_statistics().empty());
+}
+
 }  // namespace
 
 TEST(pass_manager, add) {
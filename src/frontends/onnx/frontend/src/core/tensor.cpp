@@ -483,6 +483,10 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
                 "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                 "' in the model");
         }
+    } else if (m_tensor_proto != nullptr && m_tensor_proto->has_raw_data() &&
+               m_tensor_proto->data_type() != TensorProto_DataType::TensorProto_DataType_STRING) {
+        // raw data is stored in the same layout as Constant uses, so copy it directly without an intermediate vector
+        constant = std::make_shared<ov::op::v0::Constant>(ov_type, m_shape, m_tensor_proto->raw_data().data());
     } else if (m_tensor_proto != nullptr) {
         switch (m_tensor_proto->data_type()) {
         case TensorProto_DataType::TensorProto_DataType_FLOAT:
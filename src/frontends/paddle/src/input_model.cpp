@@ -16,6 +16,7 @@
 #include "openvino/core/memory_util.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "paddle_utils.hpp"
@@ -269,7 +270,8 @@ void InputModel::InputModelImpl::load_consts(const std::filesystem::path& folder
         const auto& type = get_ov_type(tensor.data_type());
         auto data_length = ov::util::get_memory_size_safe(type, shape);
         FRONT_END_GENERAL_CHECK(data_length, "Weight tensor size overflow for constant ", name, ".");
-        std::vector<uint8_t> tensor_data(*data_length);
+        // read directly into the buffer owned by the Constant to avoid a second copy of the weights
+        auto tensor_data = std::make_shared<ov::AlignedBuffer>(*data_length);
 
         bool read_succeed = false;
         if (!folder_with_weights.empty()) {
@@ -290,7 +292,7 @@ void InputModel::InputModelImpl::load_consts(const std::filesystem::path& folder
                                     "Failed to read dims struct for ",
                                     name,
                                     ".");
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(tensor_data.data()), *data_length);
+            read_succeed = read_tensor(is, tensor_data->get_ptr<char>(), *data_length);
         } else {
             FRONT_END_GENERAL_CHECK(false, "Folder with weights must be provided.");
         }
@@ -298,7 +300,7 @@ void InputModel::InputModelImpl::load_consts(const std::filesystem::path& folder
                                 "File containing constant with name ",
                                 name,
                                 " wasn't successfully read.");
-        auto const_node = opset7::Constant::create(type, shape, tensor_data.data());
+        auto const_node = std::make_shared<opset7::Constant>(type, shape, tensor_data);
         const_node->set_friendly_name(name);
         m_tensor_values[name] = const_node;
     }
@@ -365,15 +367,16 @@ void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
         const auto& type = get_ov_type(tensor_desc->data_type());
         auto data_length = ov::util::get_memory_size_safe(type, shape);
         FRONT_END_GENERAL_CHECK(data_length, "Weight tensor size overflow for constant ", name, ".");
-        std::vector<uint8_t> tensor_data(*data_length);
+        // read directly into the buffer owned by the Constant to avoid a second copy of the weights
+        auto tensor_data = std::make_shared<ov::AlignedBuffer>(*data_length);
 
-        bool read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(tensor_data.data()), *data_length);
+        bool read_succeed = read_tensor(*weight_stream, tensor_data->get_ptr<char>(), *data_length);
         FRONT_END_GENERAL_CHECK(read_succeed,
                                 "File containing constant with name ",
                                 name,
                                 " wasn't successfully read.");
 
-        auto const_node = opset7::Constant::create(type, shape, tensor_data.data());
+        auto const_node = std::make_shared<opset7::Constant>(type, shape, tensor_data);
         const_node->set_friendly_name(name);
         m_tensor_values[name] = const_node;
     }
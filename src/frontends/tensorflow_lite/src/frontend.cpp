@@ -74,8 +74,11 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
     if (variants.size() == 1 + extra_variants_num) {
         if (const auto path = ov::frontend::get_path_from_any(variants[0])) {
             if (GraphIteratorFlatBuffer::is_supported(*path)) {
-                return std::make_shared<tensorflow_lite::InputModel>(std::make_shared<GraphIteratorFlatBuffer>(*path),
-                                                                     m_telemetry);
+                // Enable mmap by default
+                const bool mmap_enabled = extra_variants_num ? variants.back().as<bool>() : true;
+                return std::make_shared<tensorflow_lite::InputModel>(
+                    std::make_shared<GraphIteratorFlatBuffer>(*path, mmap_enabled),
+                    m_telemetry);
             }
         } else if (variants[0].is<GraphIterator::Ptr>()) {
             auto graph_iterator = variants[0].as<GraphIterator::Ptr>();
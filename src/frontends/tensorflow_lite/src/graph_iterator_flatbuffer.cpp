@@ -71,20 +71,20 @@ std::string get_builtin_operator_type(int32_t builtin_code) {
 }
 }  // namespace
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::filesystem::path& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
-
-    flatbuffers::Verifier verifier(m_data.data(), m_data.size());
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::filesystem::path& path, bool mmap_enabled)
+    : m_mmap_enabled(mmap_enabled) {
+    FRONT_END_GENERAL_CHECK(util::file_exists(path), "Model file does not exist: ", path);
+    m_data = ov::load_mmap_object(path);
+    FRONT_END_GENERAL_CHECK(m_data && m_data->data(), "Model file cannot be mapped: ", path);
+
+    const auto data = reinterpret_cast<const uint8_t*>(m_data->data());
+    flatbuffers::Verifier verifier(data, m_data->size());
     FRONT_END_GENERAL_CHECK(tflite::VerifyModelBuffer(verifier),
                             "TensorFlow Lite Frontend: the model file ",
                             path,
                             " is corrupted or malformed (FlatBuffer verification failed).");
 
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(data);
     FRONT_END_GENERAL_CHECK(m_model != nullptr, "Failed to parse TFLite model from file: ", path);
     auto sub_graphs = m_model->subgraphs();
     FRONT_END_GENERAL_CHECK(sub_graphs && sub_graphs->size() > 0, "TFLite model has no subgraphs in file: ", path);
@@ -102,6 +102,8 @@ std::shared_ptr<GraphIterator> GraphIteratorFlatBuffer::get_subgraph(size_t idx)
     FRONT_END_GENERAL_CHECK(m_subgraphs.size() > idx, "There is no subgraph with idx ", idx);
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
+    iterator->m_data = m_data;
+    iterator->m_mmap_enabled = m_mmap_enabled;
     iterator->m_model = m_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
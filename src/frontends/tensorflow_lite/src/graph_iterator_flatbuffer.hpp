@@ -12,6 +12,7 @@
 #include "openvino/frontend/tensorflow_lite/decoder.hpp"
 #include "openvino/frontend/tensorflow_lite/graph_iterator.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -25,7 +26,9 @@ struct TensorInfo {
 
 class GraphIteratorFlatBuffer : public GraphIterator {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    // memory mapped model file, shared with the sub-graph iterators and the Constants which view the model buffers
+    std::shared_ptr<ov::MappedMemory> m_data;
+    bool m_mmap_enabled = false;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -33,12 +36,18 @@ class GraphIteratorFlatBuffer : public GraphIterator {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::filesystem::path& path);
+    /// \param mmap_enabled  Constants are created as views over the mapped model file instead of copies
+    explicit GraphIteratorFlatBuffer(const std::filesystem::path& path, bool mmap_enabled = true);
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
 
     ~GraphIteratorFlatBuffer() = default;
 
+    /// Returns the memory mapped model file to be shared with Constants or nullptr if mmap is disabled
+    std::shared_ptr<ov::MappedMemory> get_mapped_memory() const {
+        return m_mmap_enabled ? m_data : nullptr;
+    }
+
     /// Verifies file is supported
     static bool is_supported(const std::filesystem::path& path) {
         FRONT_END_GENERAL_CHECK(util::file_exists(path), "Could not open the file: ", path);
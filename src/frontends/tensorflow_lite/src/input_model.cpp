@@ -7,9 +7,11 @@
 #include <iterator>
 #include <queue>
 
+#include "graph_iterator_flatbuffer.hpp"
 #include "openvino/core/memory_util.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
@@ -47,6 +49,25 @@ std::shared_ptr<ov::frontend::tensorflow_lite::TensorLitePlace> decode_output_te
     const auto& tensor_meta_info = decoder->get_output_tensor_info(idx);
     return decode_tensor_place(tensor_meta_info, model);
 }
+
+// Creates the Constant as a view over the memory mapped model file if the data is located there, a copy otherwise
+std::shared_ptr<ov::op::v0::Constant> create_constant(const std::shared_ptr<ov::MappedMemory>& mapped_memory,
+                                                      const ov::element::Type& type,
+                                                      const ov::Shape& shape,
+                                                      const void* data) {
+    if (mapped_memory && type != ov::element::string) {
+        const auto ptr = static_cast<const char*>(data);
+        const auto byte_size = ov::util::get_memory_size(type, ov::shape_size(shape));
+        const auto mapped_begin = mapped_memory->data();
+        if (ptr >= mapped_begin && ptr + byte_size <= mapped_begin + mapped_memory->size()) {
+            auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(const_cast<char*>(ptr),
+                                                                                                byte_size,
+                                                                                                mapped_memory);
+            return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
 }  // namespace
 
 namespace ov {
@@ -113,6 +134,10 @@ private:
 
 void InputModel::InputModelTFLiteImpl::load_model() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    if (auto flatbuffer_iterator = std::dynamic_pointer_cast<GraphIteratorFlatBuffer>(m_graph_iterator)) {
+        mapped_memory = flatbuffer_iterator->get_mapped_memory();
+    }
 
     m_op_places.reserve(m_graph_iterator->size());
     for (; !m_graph_iterator->is_end(); m_graph_iterator->next()) {
@@ -165,9 +190,10 @@ void InputModel::InputModelTFLiteImpl::load_model() {
                                                 required_size_opt.value(),
                                                 " bytes). The model file may be corrupted.");
                     }
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_constant(mapped_memory,
+                                                    place->get_element_type(),
+                                                    place->get_partial_shape().to_shape(),
+                                                    data);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
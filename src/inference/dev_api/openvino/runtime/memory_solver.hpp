@@ -12,6 +12,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -119,7 +120,7 @@ public:
         _time_duration = normalize_boxes(_boxes);
     }
 
-    inline bool popup_together_with(MemorySolver::Box& box_new, const MemorySolver::Box& box_old) {
+    static inline bool popup_together_with(MemorySolver::Box& box_new, const MemorySolver::Box& box_old) {
         if (box_new.id + box_new.size > box_old.id && box_old.id + box_old.size > box_new.id) {
             // Move the new one up. There is an intersection
             box_new.id = box_old.id + box_old.size;
@@ -131,49 +132,50 @@ public:
 
     /**
      * @brief Solve memory location with maximal reuse.
+     *
+     * Boxes are placed greedily, the biggest first. If that packing is above the lower bound (max_depth), the
+     * placement is repeated for a couple of other orders and the smallest packing is kept.
      * @return Size of common memory blob required for storing all
      */
     int64_t solve() {
-        max_top_depth();  // at first make sure that we no need more for boxes sorted by box.start
-        std::vector<std::vector<const Box*>> time_slots(_time_duration);
-        for (auto& slot : time_slots)
-            slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
+        // the depths are measured here, while the boxes are still sorted by start
+        const int64_t lower_bound = max_depth();
 
-        // Sort be box size. First is biggest
-        // Comment this line to check other order of box putting
-        std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+        // Sort by box size. First is biggest
+        std::vector<Box> boxes = _boxes;
+        std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r) {
             return l.size > r.size;
         });
-
-        int64_t _min_required = 0;
-
-        for (Box& box : _boxes) {
-            // start from bottom and will lift it up if intersect with other present
-            int64_t id = box.id;
-            box.id = 0;  // id will be used as a temp offset storage
-            bool popped_up;
-            do {
-                popped_up = false;
-                for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                    for (auto* box_in_slot : time_slots[i_slot]) {
-                        // intersect with already stored boxes for all covered time slots
-                        // and move up the new one if needed
-                        // Execution of 'popup_together_with' is important even if 'popped_up' is already 'true'
-                        popped_up = popup_together_with(box, *box_in_slot) || popped_up;
-                    }
-                }
-            } while (popped_up);
-
-            // add current box to covered time slot
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-                time_slots[i_slot].push_back(&box);
-
-            // store the max top bound for each box
-            _min_required = std::max(_min_required, box.id + box.size);
-            _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        int64_t min_required = place(boxes, _offsets);
+        if (min_required <= lower_bound)
+            return min_required;
+
+        const std::vector<std::function<bool(const Box&, const Box&)>> orders = {
+            // the largest footprint (size by live time) first
+            [](const Box& l, const Box& r) {
+                return l.size * (l.finish - l.start + 1) > r.size * (r.finish - r.start + 1);
+            },
+            // the latest start first, the boxes get stacked in reverse execution order
+            [](const Box& l, const Box& r) {
+                if (l.start != r.start)
+                    return l.start > r.start;
+                return l.finish > r.finish || (l.finish == r.finish && l.size > r.size);
+            },
+        };
+        for (const auto& order : orders) {
+            boxes = _boxes;
+            std::stable_sort(boxes.begin(), boxes.end(), order);
+            std::map<int64_t, int64_t> offsets;
+            const int64_t required = place(boxes, offsets);
+            if (required < min_required) {
+                min_required = required;
+                _offsets = std::move(offsets);
+                if (min_required <= lower_bound)
+                    break;
+            }
         }
 
-        return _min_required;
+        return min_required;
     }
 
     /** Provides calculated offset for specified box id */
@@ -204,6 +206,44 @@ private:
     int64_t _depth = -1;
     int _time_duration = -1;
 
+    /** Places the boxes in the provided order, stores their offsets and returns the size of the blob */
+    int64_t place(std::vector<Box>& boxes, std::map<int64_t, int64_t>& offsets) const {
+        std::vector<std::vector<const Box*>> time_slots(_time_duration);
+        for (auto& slot : time_slots)
+            slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
+
+        int64_t min_required = 0;
+        offsets.clear();
+
+        for (Box& box : boxes) {
+            // start from bottom and will lift it up if intersect with other present
+            int64_t id = box.id;
+            box.id = 0;  // id will be used as a temp offset storage
+            bool popped_up;
+            do {
+                popped_up = false;
+                for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
+                    for (auto* box_in_slot : time_slots[i_slot]) {
+                        // intersect with already stored boxes for all covered time slots
+                        // and move up the new one if needed
+                        // Execution of 'popup_together_with' is important even if 'popped_up' is already 'true'
+                        popped_up = popup_together_with(box, *box_in_slot) || popped_up;
+                    }
+                }
+            } while (popped_up);
+
+            // add current box to covered time slot
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+                time_slots[i_slot].push_back(&box);
+
+            // store the max top bound for each box
+            min_required = std::max(min_required, box.id + box.size);
+            offsets[id] = box.id;
+        }
+
+        return min_required;
+    }
+
     void calc_depth() {
         int64_t top_depth = 0;
         int64_t depth = 0;
@@ -37,6 +37,7 @@ static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK
 enum class SchedulePolicy {
     ROUND_ROBIN = 0,            // will schedule the infer request using round robin policy
     DEVICE_PRIORITY = 1,        // will schedule the infer request based on the device priority
+    LATENCY_AWARE = 2,          // will schedule the infer request to the device with the lowest measured latency
     DEFAULT = DEVICE_PRIORITY,  //!<  Default schedule policy is DEVICE_PRIORITY
 };
 
@@ -47,6 +48,8 @@ inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy)
         return os << "ROUND_ROBIN";
     case SchedulePolicy::DEVICE_PRIORITY:
         return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::LATENCY_AWARE:
+        return os << "LATENCY_AWARE";
     default:
         OPENVINO_THROW("Unsupported schedule policy value");
     }
@@ -59,6 +62,8 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
         policy = SchedulePolicy::ROUND_ROBIN;
     } else if (str == "DEVICE_PRIORITY") {
         policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "LATENCY_AWARE") {
+        policy = SchedulePolicy::LATENCY_AWARE;
     } else if (str == "DEFAULT") {
         policy = SchedulePolicy::DEFAULT;
     } else {
@@ -4,6 +4,7 @@
 
 #include "core_impl.hpp"
 
+#include <future>
 #include <memory>
 #include <optional>
 #include <variant>
@@ -1065,13 +1066,23 @@ std::vector<std::string> ov::CoreImpl::get_available_devices() const {
     std::vector<std::string> devices;
     const std::string propertyName = ov::available_devices.name();
 
+    // Plugins are created and queried concurrently (each plugin creation is guarded by its own device mutex), so the
+    // driver initialization latencies of different devices overlap instead of adding up
+    std::vector<std::pair<std::string, std::future<std::vector<std::string>>>> queries;
     for (auto&& device_name : get_registered_devices()) {
-        std::vector<std::string> devicesIDs;
         // Skip hidden devices
         if (is_hidden_device(device_name))
             continue;
+        auto query = std::async(std::launch::async, [this, device_name, &propertyName]() {
+            return get_property(device_name, propertyName, {}).as<std::vector<std::string>>();
+        });
+        queries.emplace_back(std::move(device_name), std::move(query));
+    }
+
+    for (auto&& [device_name, query] : queries) {
+        std::vector<std::string> devicesIDs;
         try {
-            devicesIDs = get_property(device_name, ov::available_devices.name(), {}).as<std::vector<std::string>>();
+            devicesIDs = query.get();
         } catch (const ov::Exception&) {
             // plugin is not created by e.g. invalid env
         } catch (const std::runtime_error&) {
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstring>
 #include <fstream>
 #include <string>
 #include <thread>
@@ -18,6 +19,7 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -172,6 +174,35 @@ TEST(NetworkContext, HashOfSame) {
     ASSERT_EQ(ov::ModelCache::compute_hash(model1, {}), ov::ModelCache::compute_hash(model2, {}));
 }
 
+TEST(NetworkContext, HashOfSharedWeights) {
+    auto make_model = [](const std::shared_ptr<ov::op::v0::Constant>& constant) {
+        auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::i8, ov::Shape{4});
+        auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+        auto res = std::make_shared<ov::op::v0::Result>(add);
+        return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+    };
+    auto make_shared_constant = [](const std::vector<int8_t>& values) {
+        auto source = std::make_shared<ov::AlignedBuffer>(values.size());
+        std::memcpy(source->get_ptr(), values.data(), values.size());
+        auto weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+            source->get_ptr<char>(),
+            source->size(),
+            source,
+            ov::create_base_descriptor(1, 0, source));
+        return std::make_shared<ov::op::v0::Constant>(ov::element::i8, ov::Shape{values.size()}, weights);
+    };
+
+    auto shared_model = make_model(make_shared_constant({1, 2, 3, 4}));
+    auto plain_model = make_model(ov::op::v0::Constant::create(ov::element::i8, ov::Shape{4}, {1, 2, 3, 4}));
+    const auto hash = ov::ModelCache::compute_hash(shared_model, {});
+    // the memoized content hash of the shared weights is reused and matches the one computed from scratch
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(shared_model, {}));
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(plain_model, {}));
+
+    auto other_model = make_model(make_shared_constant({1, 2, 3, 5}));
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(other_model, {}));
+}
+
 TEST(NetworkContext, HashWithConfig) {
     auto net1 = create_simple_model();
     auto net2 = create_simple_model();
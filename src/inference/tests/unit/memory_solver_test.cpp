@@ -142,7 +142,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
 //  |  |_4__|_____ |    |
 //  |__|_2________||_1__|___
 //      2  3  4  5  6  7  8
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{
         {6, 7, 3},
         {2, 5, 2},
@@ -151,7 +151,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     ov::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);  // the biggest first placement gives 6
     EXPECT_EQ(ms.max_depth(), 5);
     EXPECT_EQ(ms.max_top_depth(), 2);
 }
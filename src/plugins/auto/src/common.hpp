@@ -66,6 +66,7 @@ struct WorkerInferRequest {
     std::exception_ptr            m_exception_ptr = nullptr;
     std::list<Time>               m_start_times;
     std::list<Time>               m_end_times;
+    Time                          m_dispatch_time;
     int                           m_index = 0;
     AutoImmediateExecutor::Ptr    m_fallback_exec;
 };
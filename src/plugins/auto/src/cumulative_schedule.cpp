@@ -8,6 +8,8 @@
 #include "plugin.hpp"
 #include "openvino/util/file_util.hpp"
 
+#include <algorithm>
+
 // ------------------------------CumuSchedule----------------------------
 namespace ov {
 namespace auto_plugin {
@@ -26,10 +28,56 @@ std::string CumuSchedule::schedule_to_next_device(const std::vector<DeviceInform
         m_n_ctput_schedule_next_device++;
     } else if (schedule_policy == ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY) {
         selected_device_name = devices[current_device_index].device_name;
+    } else if (schedule_policy == ov::intel_auto::SchedulePolicy::LATENCY_AWARE) {
+        // rank the devices by the measured latency, the devices without measurements yet go first (in the priority
+        // order) so that every device gets probed
+        std::vector<std::pair<double, std::size_t>> ranks;
+        ranks.reserve(devices.size());
+        {
+            std::lock_guard<std::mutex> lock(m_latency_mutex);
+            for (std::size_t i = 0; i < devices.size(); i++) {
+                auto it = m_device_latency.find(devices[i].device_name);
+                ranks.emplace_back(it == m_device_latency.end() ? 0.0 : it->second, i);
+            }
+        }
+        std::stable_sort(ranks.begin(), ranks.end(), [](const std::pair<double, std::size_t>& a,
+                                                        const std::pair<double, std::size_t>& b) {
+            return a.first < b.first;
+        });
+        selected_device_name = devices[ranks[current_device_index].second].device_name;
     }
     return selected_device_name;
 }
 
+void CumuSchedule::on_infer_completed(const std::string& device, const WorkerInferRequest& worker_request) {
+    const double latency =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - worker_request.m_dispatch_time)
+            .count();
+    std::lock_guard<std::mutex> lock(m_latency_mutex);
+    auto& count = m_device_infer_count[device];
+    auto& smoothed = m_device_latency[device];
+    smoothed = count == 0 ? latency : 0.875 * smoothed + 0.125 * latency;
+    count++;
+}
+
+bool CumuSchedule::should_wait_for_device(const std::string& busy_device,
+                                          const std::vector<DeviceInformation>& devices,
+                                          std::size_t next_device_index) {
+    if (next_device_index >= devices.size()) {
+        return false;
+    }
+    const auto next_device = schedule_to_next_device(devices, next_device_index);
+    std::lock_guard<std::mutex> lock(m_latency_mutex);
+    auto busy = m_device_latency.find(busy_device);
+    auto next = m_device_latency.find(next_device);
+    if (busy == m_device_latency.end() || next == m_device_latency.end()) {
+        return false;
+    }
+    // the request queued for the busy device waits for the residual of the running inference (at most one latency)
+    // and completes earlier than on the next idle device, if that one is more than twice slower
+    return 2 * busy->second < next->second;
+}
+
 bool CumuSchedule::select_other_device(const std::string& cur_dev_name) {
     {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -249,6 +297,13 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         if (run_pipeline_task(pipeline_task, m_idle_worker_requests[selected_device_name], preferred_device)) {
             return true;
         } else {
+            if (preferred_device.empty() &&
+                m_context->m_schedule_policy == ov::intel_auto::SchedulePolicy::LATENCY_AWARE &&
+                should_wait_for_device(selected_device_name, devices, current_device_index + 1)) {
+                // queue the task for the busy device, its worker callback picks the task up on the infer completion
+                m_infer_pipeline_tasks_device_specific[selected_device_name]->push(std::move(pipeline_task));
+                return false;
+            }
             current_device_index++;
         }
     }
@@ -263,6 +318,19 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
 }
 
 CumuSchedule::~CumuSchedule() {
+    {
+        std::lock_guard<std::mutex> lock(m_latency_mutex);
+        std::size_t total = 0;
+        for (const auto& count : m_device_infer_count) {
+            total += count.second;
+        }
+        for (const auto& count : m_device_infer_count) {
+            LOG_INFO_TAG("%s: infer share:%lf%%, latency:%lf ms",
+                         count.first.c_str(),
+                         100.0 * count.second / total,
+                         m_device_latency[count.first]);
+        }
+    }
     if (m_context) {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
         m_context->m_device_priorities.clear();
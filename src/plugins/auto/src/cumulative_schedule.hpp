@@ -20,6 +20,15 @@ public:
     size_t                                  m_n_ctput_schedule_next_device = 0;
     std::string schedule_to_next_device(const std::vector<DeviceInformation>& devices,
                                         std::size_t current_device_index);
+    // per-device statistics used by the LATENCY_AWARE schedule policy
+    std::mutex                              m_latency_mutex;
+    DeviceMap<double>                       m_device_latency;  // smoothed latency of a single infer request, ms
+    DeviceMap<std::size_t>                  m_device_infer_count;
+protected:
+    void on_infer_completed(const std::string& device, const WorkerInferRequest& worker_request) override;
+    bool should_wait_for_device(const std::string& busy_device,
+                                const std::vector<DeviceInformation>& devices,
+                                std::size_t next_device_index);
 private:
     void init() override;
     SoCompiledModel wait_first_compiled_model_ready() override;
@@ -112,6 +112,9 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
                         captured_task();
                     };
                     // will fallback to other devices if enable m_runtime_fallback
+                    if (worker_request_ptr->m_exception_ptr == nullptr) {
+                        on_infer_completed(device, *worker_request_ptr);
+                    }
                     if (worker_request_ptr->m_exception_ptr != nullptr && m_context->m_runtime_fallback) {
                         bool select_other_device_flag = false;
                         // select other device
@@ -235,6 +238,7 @@ Pipeline Schedule::get_async_pipeline(const ISyncInferPtr& infer_request, Worker
             Stage {
                 /*TaskExecutor*/std::dynamic_pointer_cast<ov::threading::ITaskExecutor>(shared_from_this()), /*task*/ [&infer_request, worker_infer_request]() {
                     *worker_infer_request = m_this_worker_infer_request;
+                    m_this_worker_infer_request->m_dispatch_time = std::chrono::steady_clock::now();
                     auto auto_request = std::dynamic_pointer_cast<InferRequest>(infer_request);
                     auto_request->set_tensors_to_another_request(m_this_worker_infer_request->m_inferrequest);
                     INFO_RUN([worker_infer_request]() {
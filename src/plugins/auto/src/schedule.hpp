@@ -36,6 +36,8 @@ protected:
     virtual bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") = 0;
     virtual bool select_other_device(const std::string& cur_dev_name) = 0;
     virtual SoCompiledModel wait_first_compiled_model_ready() = 0;
+    // called from the worker callback when the inference on the device finished successfully
+    virtual void on_infer_completed(const std::string& device, const WorkerInferRequest& worker_request) {}
     std::string get_log_tag() const noexcept;
     std::shared_ptr<ov::threading::IStreamsExecutor>                     m_executor;
     DeviceMap<NotBusyPriorityWorkerRequests>                             m_idle_worker_requests;
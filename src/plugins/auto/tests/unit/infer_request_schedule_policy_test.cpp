@@ -136,4 +136,44 @@ const std::vector<ConfigParams> configs = {
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests,
                          MockCumuSchedule,
                          ::testing::ValuesIn(configs),
-                         MockCumuSchedule::getTestCaseName);
\ No newline at end of file
+                         MockCumuSchedule::getTestCaseName);
+
+class LatencyAwareCumuSchedule : public ov::auto_plugin::CumuSchedule, public ::testing::Test {
+public:
+    void SetUp() override {
+        m_context = std::make_shared<ov::auto_plugin::ScheduleContext>();
+        m_context->m_schedule_policy = ov::intel_auto::SchedulePolicy::LATENCY_AWARE;
+    }
+
+    void TearDown() override {
+        m_context.reset();
+    }
+};
+
+TEST_F(LatencyAwareCumuSchedule, scheduleInferRequestBasedOnMeasuredLatency) {
+    const std::vector<ov::auto_plugin::DeviceInformation> devices = {{"DEVICE_0", {}, -1, "01", "DEVICE_0_01", 0},
+                                                                     {"DEVICE_1", {}, -1, "01", "DEVICE_1_01", 1},
+                                                                     {"DEVICE_2", {}, -1, "01", "DEVICE_2_01", 2}};
+    // nothing is measured yet, so the priority order is kept
+    EXPECT_EQ(schedule_to_next_device(devices, 0), "DEVICE_0");
+    EXPECT_EQ(schedule_to_next_device(devices, 2), "DEVICE_2");
+
+    m_device_latency = {{"DEVICE_0", 30.0}, {"DEVICE_1", 3.0}};
+    m_device_infer_count = {{"DEVICE_0", 1}, {"DEVICE_1", 1}};
+    // unmeasured device is probed first, then the fastest one
+    EXPECT_EQ(schedule_to_next_device(devices, 0), "DEVICE_2");
+    EXPECT_EQ(schedule_to_next_device(devices, 1), "DEVICE_1");
+    EXPECT_EQ(schedule_to_next_device(devices, 2), "DEVICE_0");
+
+    ov::auto_plugin::WorkerInferRequest worker;
+    worker.m_dispatch_time = std::chrono::steady_clock::now();
+    on_infer_completed("DEVICE_2", worker);
+    EXPECT_EQ(m_device_infer_count["DEVICE_2"], 1u);
+    EXPECT_EQ(schedule_to_next_device(devices, 0), "DEVICE_2");
+
+    // the busy device is worth waiting for when the next one is more than twice slower
+    EXPECT_TRUE(should_wait_for_device("DEVICE_1", devices, 2));
+    EXPECT_FALSE(should_wait_for_device("DEVICE_0", devices, 3));
+    m_device_latency["DEVICE_0"] = 5.0;
+    EXPECT_FALSE(should_wait_for_device("DEVICE_1", devices, 2));
+}
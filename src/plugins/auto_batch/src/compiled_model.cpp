@@ -5,6 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
@@ -80,6 +83,19 @@ CompiledModel::GetWorkerInferRequest() const {
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // exponentially smoothed arrival rate (requests per ms), measured between the consecutive dispatches
+            double arrival_rate = 0.0;
+            auto last_dispatch = std::chrono::steady_clock::now();
+            auto update_load = [&](int dispatched) {
+                const auto now = std::chrono::steady_clock::now();
+                const double elapsed =
+                    std::max(std::chrono::duration<double, std::milli>(now - last_dispatch).count(), 1e-3);
+                last_dispatch = now;
+                const double rate = dispatched / elapsed;
+                arrival_rate = arrival_rate == 0.0 ? rate : 0.5 * (arrival_rate + rate);
+                // with fewer expected arrivals per timeout than a batch holds, the batch will not be collected anyway
+                workerRequestPtr->_low_load = arrival_rate * m_time_out < workerRequestPtr->_batch_size;
+            };
             while (1) {
                 std::cv_status status;
                 {
@@ -104,11 +120,13 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        update_load(sz);
                         workerRequestPtr->_infer_request_batched->start_async();
-                    } else if ((status == std::cv_status::timeout) && sz) {
+                    } else if ((status == std::cv_status::timeout || workerRequestPtr->_low_load) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        update_load(sz);
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <thread>
 
@@ -31,6 +32,9 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // set when the observed arrival rate is too low to fill the batch within the timeout, so waiting for the
+        // timeout only adds latency: the requests are then dispatched in the batch1 mode as soon as they arrive
+        std::atomic_bool _low_load = {false};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
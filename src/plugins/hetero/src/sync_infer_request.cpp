@@ -13,10 +13,40 @@
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iremote_context.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
 
+namespace {
+// Allocates the tensor connecting two subgraphs. When one of the devices is not a CPU, the tensor is allocated with
+// that device's host allocator (e.g. USM host on GPU, level-zero host memory on NPU), so the device can access it
+// directly instead of staging the data through an internal copy
+ov::SoPtr<ov::ITensor> create_boundary_tensor(const ov::Output<const ov::Node>& output_port,
+                                              const ov::SoPtr<ov::ITensor>& output_tensor,
+                                              const ov::SoPtr<ov::IAsyncInferRequest>& producer,
+                                              const ov::SoPtr<ov::IAsyncInferRequest>& consumer) {
+    if (output_port.get_partial_shape().is_static()) {
+        for (const auto& request : {consumer, producer}) {
+            try {
+                auto context = request->get_compiled_model()->get_context();
+                if (context && context->get_device_name().find("CPU") == std::string::npos) {
+                    auto tensor =
+                        context->create_host_tensor(output_tensor->get_element_type(), output_tensor->get_shape());
+                    if (!tensor._so) {
+                        tensor._so = context._so;
+                    }
+                    return tensor;
+                }
+            } catch (const ov::Exception&) {
+                // the device does not provide a host allocator, try the other one or fall back to a plain tensor
+            }
+        }
+    }
+    return {ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()), nullptr};
+}
+}  // namespace
+
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
     : ov::ISyncInferRequest(compiled_model) {
     for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
@@ -45,9 +75,10 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
         const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
         if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+            temp_tensor_map[output_port] = create_boundary_tensor(output_port,
+                                                                  output_tensor,
+                                                                  m_subrequests[submodel_idx_out],
+                                                                  m_subrequests[submodel_idx_in]);
         }
         m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
         const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
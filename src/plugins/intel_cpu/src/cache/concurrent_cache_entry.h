@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "cache_entry.h"
+#include "lru_cache.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Thread safe counterpart of the CacheEntry class which may be shared between several streams.
+ * The records are distributed over a fixed number of shards by the key hash, each shard is an independent LruCache
+ * guarded by its own mutex, so concurrent lookups of different keys rarely contend on the same lock.
+ * The builds are single-flight: when several threads miss the same key simultaneously, only the first one invokes the
+ * builder while the others wait for its result instead of creating an identical object.
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
+ * @tparam NumShards is the number of independent LRU buckets
+ *
+ * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The capacity is distributed evenly between the shards, so the eviction order is LRU within a shard only.
+ */
+
+template <typename KeyType, typename ValType, size_t NumShards = 16>
+class ConcurrentCacheEntry : public CacheEntryBase {
+    static_assert(NumShards > 0, "ConcurrentCacheEntry requires at least one shard");
+
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+    explicit ConcurrentCacheEntry(size_t capacity) : _capacity(capacity) {
+        const size_t shardCapacity = (capacity + NumShards - 1) / NumShards;
+        for (auto& shard : _shards) {
+            shard.impl = std::make_unique<LruCache<KeyType, ValType>>(shardCapacity);
+        }
+    }
+
+    /**
+     * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the
+     * builder functor and adds it to the underlying storage. If the same key is being built by another thread at the
+     * moment, waits for that build to finish and returns its result.
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the
+     * cache hit or miss occurred
+     */
+
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _capacity) {
+            // fast track
+            return {builder(key), LookUpStatus::Miss};
+        }
+
+        auto& shard = _shards[static_cast<size_t>(key.hash()) % NumShards];
+        const auto retEmpty = ValType();
+        std::promise<ValType> promise;
+        std::shared_future<ValType> pending;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            ValType retVal = shard.impl->get(key);
+            if (retVal != retEmpty) {
+                return {retVal, LookUpStatus::Hit};
+            }
+            auto itr = shard.inFlight.find(key);
+            if (itr != shard.inFlight.end()) {
+                pending = itr->second;
+            } else {
+                shard.inFlight.emplace(key, promise.get_future().share());
+            }
+        }
+
+        if (pending.valid()) {
+            // the object is being created by another thread, the builder exceptions are propagated to all the waiters
+            return {pending.get(), LookUpStatus::Hit};
+        }
+
+        ValType retVal;
+        try {
+            retVal = builder(key);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.inFlight.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (retVal != retEmpty) {
+                shard.impl->put(key, retVal);
+            }
+            shard.inFlight.erase(key);
+        }
+        promise.set_value(retVal);
+        return {retVal, LookUpStatus::Miss};
+    }
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const KeyType& k) const {
+            return k.hash();
+        }
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::unique_ptr<LruCache<KeyType, ValType>> impl;
+        std::unordered_map<KeyType, std::shared_future<ValType>, key_hasher> inFlight;
+    };
+
+    size_t _capacity;
+    std::array<Shard, NumShards> _shards;
+};
+
+}  // namespace ov::intel_cpu
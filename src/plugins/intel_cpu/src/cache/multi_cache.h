@@ -7,17 +7,20 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "concurrent_cache_entry.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention By default this implementation IS NOT THREAD SAFE! Use the threadSafe constructor parameter to create an
+ * instance which may be shared between several streams.
  */
 
 class MultiCache {
@@ -26,13 +29,16 @@ public:
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = ConcurrentCacheEntry<KeyType, ValueType>;
+    template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param threadSafe defines whether the entries are sharded and guarded, so the cache may be used concurrently
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,18 +53,29 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_threadSafe) {
+            auto entry = getEntry<ConcurrentEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    [[nodiscard]] bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe;
+    // the entries are shallow copied along with the cache, so the mutex guarding them is shared as well
+    std::shared_ptr<std::mutex> _storageMutex = std::make_shared<std::mutex>();
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -68,10 +85,13 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(*_storageMutex, std::defer_lock);
+    if (_threadSafe) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
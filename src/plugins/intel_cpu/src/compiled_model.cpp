@@ -5,15 +5,22 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <exception>
+#include <filesystem>
+#include <iomanip>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
@@ -29,15 +36,19 @@
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/graph_serializer/serializer.hpp"
+#include "utils/warmup_shapes.hpp"
 #ifdef CPU_DEBUG_CAPS
 #    include "utils/memory_stats_dump.hpp"
 #endif
@@ -61,7 +72,29 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+namespace {
+
+std::string generate_warmup_file_id() {
+    std::random_device device;
+    std::stringstream ss;
+    ss << std::hex;
+    for (int i = 0; i < 4; i++) {
+        ss << std::setw(8) << std::setfill('0') << device();
+    }
+    return ss.str();
+}
+
+}  // namespace
+
 CompiledModel::~CompiledModel() {
+    {
+        // the pending warm-up tasks see the model is gone, the running ones stop after the current shapes
+        std::unique_lock<std::mutex> lock(m_warmupState->mutex);
+        m_warmupState->alive = false;
+        m_warmupState->cv.wait(lock, [this] {
+            return m_warmupState->running == 0;
+        });
+    }
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -84,8 +117,43 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(m_cfg.weightsNumaPlacement),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (m_cfg.rtCacheShared) {
+        m_sharedParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true);
+        m_sharedSnippetsParamsCache = std::make_shared<MultiCache>(m_cfg.snippetsCacheCapacity, true);
+    }
+    if (m_loaded_from_cache && m_model->has_rt_info(WarmupShapes::rt_info_key)) {
+        m_warmupShapes = WarmupShapes::deserialize(m_model->get_rt_info<std::string>(WarmupShapes::rt_info_key));
+    }
+    auto add_warmup_shapes = [this](std::vector<WarmupShapes::InputShapes> shapes_list) {
+        for (auto& shapes : shapes_list) {
+            if (std::find(m_warmupShapes.begin(), m_warmupShapes.end(), shapes) == m_warmupShapes.end()) {
+                m_warmupShapes.push_back(std::move(shapes));
+            }
+        }
+    };
+    if (!m_cfg.cacheDir.empty()) {
+        // the core exports the model to the cache right after the compilation, i.e. before any shape is recorded, so
+        // the recorded shapes are kept in a file next to the blob, the file name is stored in the exported model
+        std::string file_id;
+        if (m_loaded_from_cache && m_model->has_rt_info(WarmupShapes::file_id_rt_info_key)) {
+            file_id = m_model->get_rt_info<std::string>(WarmupShapes::file_id_rt_info_key);
+        } else {
+            file_id = generate_warmup_file_id();
+            m_model->get_rt_info()[WarmupShapes::file_id_rt_info_key] = file_id;
+        }
+        m_warmupShapesFile = ov::util::make_path(m_cfg.cacheDir) / (file_id + WarmupShapes::file_extension);
+        if (m_loaded_from_cache) {
+            try {
+                add_warmup_shapes(WarmupShapes::load(m_warmupShapesFile));
+            } catch (const std::exception& e) {
+                DEBUG_LOG("Failed to load the CPU warm-up shapes from ", m_warmupShapesFile, ": ", e.what());
+            }
+        }
+    }
+    add_warmup_shapes(WarmupShapes::deserialize(m_cfg.warmupShapes));
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -151,6 +219,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
         m_has_sub_compiled_models = true;
         auto sub_cfg = m_cfg;
         sub_cfg.numSubStreams = 0;
+        // the warm-up shapes are recorded by the main compiled model only
+        sub_cfg.cacheDir.clear();
+        sub_cfg.recordWarmupShapes = false;
         sub_cfg.enableNodeSplit = true;
         auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
         auto message = message_manager();
@@ -175,21 +246,26 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     }
 }
 
+size_t CompiledModel::get_graph_index() const {
+    if (m_graphs.size() > 1) {
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+        if (nullptr != streamsExecutor) {
+            return streamsExecutor->get_stream_id() % m_graphs.size();
+        }
+    }
+    return 0;
+}
+
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
-    int streamId = 0;
     int socketId = 0;
-
-    size_t graph_idx = 0;
     if (m_graphs.size() > 1) {
         auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
         if (nullptr != streamsExecutor) {
-            streamId = streamsExecutor->get_stream_id();
             socketId = std::max(0, streamsExecutor->get_socket_id());
         }
-        graph_idx = streamId % m_graphs.size();
     }
 
-    auto graphLock = GraphGuard::Lock(m_graphs[graph_idx]);
+    auto graphLock = GraphGuard::Lock(m_graphs[get_graph_index()]);
 
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
@@ -207,7 +283,9 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedParamsCache,
+                                                         m_sharedSnippetsParamsCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -234,7 +312,125 @@ std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request(
         CompiledModelHolder(std::static_pointer_cast<const CompiledModel>(shared_from_this())));
 }
 
+void CompiledModel::warm_up() const {
+    // stateful models are excluded since the warm-up inferences would modify the states
+    if (m_warmupShapes.empty() || m_has_sub_compiled_models || !m_model->get_variables().empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_warmupState->mutex);
+        m_warmupState->warmedGraphs.assign(m_graphs.size(), false);
+        m_warmupState->pending = m_graphs.size();
+    }
+    for (size_t i = 0; i < m_graphs.size(); i++) {
+        schedule_warm_up(0);
+    }
+}
+
+void CompiledModel::schedule_warm_up(size_t attempt) const {
+    // a task may land on a stream, which has been warmed up already, then it is rescheduled a limited number of times
+    const size_t max_attempts = 4 * m_graphs.size();
+    m_task_executor->run([this, state = m_warmupState, attempt, max_attempts] {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!state->alive) {
+                state->pending--;
+                state->cv.notify_all();
+                return;
+            }
+            state->running++;
+        }
+        const auto graph_idx = get_graph_index();
+        bool claimed = false;
+        bool reschedule = false;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!state->warmedGraphs[graph_idx]) {
+                state->warmedGraphs[graph_idx] = true;
+                claimed = true;
+            } else {
+                reschedule = attempt < max_attempts;
+            }
+        }
+        if (claimed) {
+            try {
+                warm_up_graph();
+            } catch (const std::exception& e) {
+                DEBUG_LOG("The CPU warm-up of ", m_name, " failed: ", e.what());
+            }
+        } else if (reschedule) {
+            schedule_warm_up(attempt + 1);
+        } else {
+            DEBUG_LOG("The CPU warm-up of ", m_name, " has not reached every stream graph");
+        }
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->running--;
+        if (!reschedule) {
+            state->pending--;
+        }
+        state->cv.notify_all();
+    });
+}
+
+void CompiledModel::warm_up_graph() const {
+    auto request = create_sync_infer_request();
+    const auto& inputs = request->get_inputs();
+    for (const auto& shapes : m_warmupShapes) {
+        if (!m_warmupState->alive) {
+            return;
+        }
+        if (shapes.size() != inputs.size()) {
+            DEBUG_LOG("The CPU warm-up skips ",
+                      ov::util::vector_to_string(shapes),
+                      ": the model has ",
+                      inputs.size(),
+                      " inputs");
+            continue;
+        }
+        try {
+            for (size_t i = 0; i < inputs.size(); i++) {
+                const auto& precision = inputs[i].get_element_type();
+                OPENVINO_ASSERT(precision != ov::element::string, "String inputs are not supported by warm-up");
+                auto tensor = ov::make_tensor(precision, shapes[i]);
+                std::memset(tensor->data(), 0, tensor->get_byte_size());
+                request->set_tensor(inputs[i], tensor);
+            }
+            request->infer();
+            if (m_recordedWarmupShapes.record(shapes)) {
+                store_recorded_warmup_shapes();
+            }
+        } catch (const std::exception& e) {
+            // data dependent shapes may be incompatible with zero filled inputs, so such combinations are skipped
+            DEBUG_LOG("The CPU warm-up failed for ", ov::util::vector_to_string(shapes), ": ", e.what());
+        } catch (...) {
+            DEBUG_LOG("The CPU warm-up failed for ", ov::util::vector_to_string(shapes));
+        }
+    }
+}
+
+void CompiledModel::wait_for_warm_up() const {
+    std::unique_lock<std::mutex> lock(m_warmupState->mutex);
+    m_warmupState->cv.wait(lock, [this] {
+        return m_warmupState->pending == 0;
+    });
+}
+
+void CompiledModel::store_recorded_warmup_shapes() const {
+    if (m_warmupShapesFile.empty()) {
+        return;
+    }
+    try {
+        m_recordedWarmupShapes.store(m_warmupShapesFile);
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Failed to store the CPU warm-up shapes to ", m_warmupShapesFile, ": ", e.what());
+    }
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
+    std::call_once(m_warmupFlag, [this] {
+        warm_up();
+    });
     auto internal_request = create_sync_infer_request();
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
@@ -415,6 +611,12 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
+    // the replayed warm-up shapes are exported as well
+    wait_for_warm_up();
+    if (!m_recordedWarmupShapes.empty()) {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        m_model->get_rt_info()[WarmupShapes::rt_info_key] = m_recordedWarmupShapes.serialize();
+    }
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
     serializer << m_model;
 }
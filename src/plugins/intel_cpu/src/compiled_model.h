@@ -5,7 +5,9 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <deque>
+#include <filesystem>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -13,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
@@ -24,6 +27,7 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/warmup_shapes.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -87,6 +91,27 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // thread safe runtime caches shared by all the stream graphs (only if Config::rtCacheShared is set)
+    MultiCachePtr m_sharedParamsCache = nullptr;
+    MultiCachePtr m_sharedSnippetsParamsCache = nullptr;
+    // input shapes seen by the dynamic graphs (only if Config::recordWarmupShapes is set) and the replayed warm-up
+    // shapes, exported with the model to warm up the runtime caches after import
+    mutable WarmupShapes m_recordedWarmupShapes;
+    // file under Config::cacheDir, which keeps m_recordedWarmupShapes for the models loaded from the cache
+    std::filesystem::path m_warmupShapesFile;
+    // shapes to warm up with: the imported ones and the ones requested by Config::warmupShapes
+    std::vector<WarmupShapes::InputShapes> m_warmupShapes;
+    mutable std::once_flag m_warmupFlag;
+    // the warm-up runs asynchronously on the streams, the tasks check the state before touching the compiled model
+    struct WarmupState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic_bool alive{true};
+        size_t running = 0;  // tasks executing the warm-up right now
+        size_t pending = 0;  // tasks scheduled and not finished yet
+        std::vector<bool> warmedGraphs;
+    };
+    std::shared_ptr<WarmupState> m_warmupState = std::make_shared<WarmupState>();
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,6 +119,20 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    size_t get_graph_index() const;
+
+    /* Schedules zero filled inferences for the imported and requested warm-up shapes on every stream, so the dynamic
+     * shape primitives are created ahead of the user inferences. The calling thread doesn't wait for them.
+     */
+    void warm_up() const;
+    void schedule_warm_up(size_t attempt) const;
+    // replays the warm-up shapes on the graph of the calling stream
+    void warm_up_graph() const;
+    void wait_for_warm_up() const;
+
+    // writes m_recordedWarmupShapes to m_warmupShapesFile, if any; a new combination is stored at most once
+    void store_recorded_warmup_shapes() const;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -152,6 +191,17 @@ public:
         return m_id;
     }
 
+    // true if Config::recordWarmupShapes is set and the recorded shapes capacity is not exhausted yet
+    [[nodiscard]] bool recordsInputShapes() const {
+        return m_compiled_model->m_cfg.recordWarmupShapes && !m_compiled_model->m_recordedWarmupShapes.full();
+    }
+
+    void recordInputShapes(const WarmupShapes::InputShapes& shapes) const {
+        if (m_compiled_model->m_recordedWarmupShapes.record(shapes)) {
+            m_compiled_model->store_recorded_warmup_shapes();
+        }
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
@@ -21,10 +21,12 @@
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/weightless_properties_utils.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/precision_support.h"
+#include "utils/warmup_shapes.hpp"
 
 #if defined(OPENVINO_ARCH_ARM64)
 #    include <limits>
@@ -286,6 +288,81 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_weights_numa_placement.name() == key) {
+            try {
+                weightsNumaPlacement = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_numa_placement.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_dynamic_memory_growth.name() == key) {
+            try {
+                dynamicMemoryGrowth = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_memory_growth.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_executor_tuning.name() == key) {
+            try {
+                executorTuning = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_executor_tuning.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_parallel_graph_init.name() == key) {
+            try {
+                parallelGraphInit = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_parallel_graph_init.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_warmup_shapes.name() == key) {
+            warmupShapes = val.as<std::string>();
+            // validates the format early
+            WarmupShapes::deserialize(warmupShapes);
+        } else if (ov::intel_cpu::cpu_record_warmup_shapes.name() == key) {
+            try {
+                recordWarmupShapes = val.as<bool>();
+                recordWarmupShapesSetExplicitly = true;
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_record_warmup_shapes.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_profile_preparation.name() == key) {
+            try {
+                collectPreparePerfCounters = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_profile_preparation.name(),
+                               ". Expected only true/false");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -487,6 +564,8 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (...) {
                 OPENVINO_THROW("Wrong value for property key ", ov::cache_mode.name());
             }
+        } else if (key == ov::cache_dir.name()) {
+            cacheDir = val.as<std::string>();
         } else if (key == ov::hint::model.name() || key == ov::internal::caching_with_mmap.name() ||
                    key == ov::weights_path.name()) {
             // do nothing
@@ -538,6 +617,10 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
         aclFastMath = true;
     }
 #endif
+    // the shapes recorded under the model cache directory warm up the models loaded from this cache
+    if (!recordWarmupShapesSetExplicitly) {
+        recordWarmupShapes = !cacheDir.empty();
+    }
     // key/value cache precision has higher priority, if not defined use kvCachePrecision
     if (!keyCachePrecisionSetExplicitly && kvCachePrecisionSetExplicitly) {
         keyCachePrecision = kvCachePrecision;
@@ -545,6 +628,10 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
     if (!valueCachePrecisionSetExplicitly && kvCachePrecisionSetExplicitly) {
         valueCachePrecision = kvCachePrecision;
     }
+    // sage attention relies on s8s8 dot products, fall back to the regular attention path when they are not available
+    if (enableSageAttn && !(ov::with_cpu_x86_avx512_core_amx_int8() || mayiuse(avx2_vnni_2))) {
+        enableSageAttn = false;
+    }
     if (enableSageAttn) {
         keyCachePrecision = ov::element::i8;
         keyCacheQuantMode = CacheQuantMode::BY_TOKEN;
@@ -53,10 +53,16 @@ struct Config {
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    bool collectPreparePerfCounters = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
     std::string device_id;
+    std::string warmupShapes;
+    bool recordWarmupShapes = false;
+    bool recordWarmupShapesSetExplicitly = false;
+    // model cache directory passed by the core, keeps the shapes recorded for the warm-up of the cached models
+    std::string cacheDir;
     float fcSparseWeiDecompressionRate = 1.0F;
     uint64_t fcDynamicQuantizationGroupSize = 32;
     bool fcDynamicQuantizationGroupSizeSetExplicitly = false;
@@ -75,6 +81,11 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    bool weightsNumaPlacement = false;
+    bool dynamicMemoryGrowth = false;
+    bool executorTuning = false;
+    bool parallelGraphInit = false;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -38,6 +38,7 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <sys/mman.h>
 #    include <unistd.h>
 
 #    include <cstring> /* strerror(errno) */
@@ -56,6 +57,9 @@ BlockedMemoryDescPtr IMemory::getDescWithType<BlockedMemoryDesc>() const {
 }
 
 namespace {
+// the blocks of at least this size are advised to be backed by the transparent huge pages
+constexpr uintptr_t huge_page_size = 2 * 1024 * 1024;
+
 inline void setSubnormalsToZeroAndbf16Saturation(float* data, size_t size, bool ftz, bool bf16saturation) {
     auto* u32data = reinterpret_cast<uint32_t*>(data);
     auto* floatdata = data;
@@ -260,6 +264,12 @@ bool MemoryBlockWithReuse::resize(size_t size) {
         m_data = decltype(m_data)(ptr, destroy);
         sizeChanged = true;
 
+        if (size >= huge_page_size) {
+            if (!madvise_huge_pages(ptr, size)) {
+                DEBUG_LOG("MemoryBlockWithReuse madvise huge pages failed\n");
+            }
+        }
+
         if (numa_node >= 0) {
             if (!mbind_move(ptr, size, numa_node)) {
                 DEBUG_LOG("MemoryBlockWithReuse move_memory to node ", numa_node, " failed\n");
@@ -608,6 +618,27 @@ bool mbind_move(void* data, size_t size, int targetNode) {
 }
 #endif
 
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+bool madvise_huge_pages(void* data, size_t size) {
+    // only the huge page aligned part of the block can be backed by the huge pages
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + huge_page_size - 1) & ~(huge_page_size - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) & ~(huge_page_size - 1);
+    if (end <= begin) {
+        return true;
+    }
+    auto rc = madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);  // NOLINT(performance-no-int-to-ptr)
+    if (rc < 0) {
+        DEBUG_LOG("madvise failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
+#else
+bool madvise_huge_pages(void* data, size_t size) {
+    return false;
+}
+#endif
+
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
     void* data = mem->getData();
     auto size = mem->getSize();
@@ -446,6 +446,12 @@ using MemoryCPtr = std::shared_ptr<const IMemory>;
 using StringMemoryPtr = std::shared_ptr<StringMemory>;
 
 bool mbind_move(void* data, size_t size, int targetNode);
+/**
+ * @brief Advises the OS to back the memory block with transparent huge pages. Has effect only for the huge page aligned
+ * part of the block and only when THP is not disabled in the system.
+ * @return false if the advice is rejected or not supported on the platform
+ */
+bool madvise_huge_pages(void* data, size_t size);
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID);
 bool mbind_move(const dnnl::memory& mem, int numaNodeID);
 
@@ -1136,6 +1136,11 @@ void configure_x86_hybrid_threads(Config& config,
             config.modelPreferThreadsLatency = main_cores + efficient_cores;
             determine_tbb_partitioner_and_threads(config, proc_type_table, tolerance, int8_intensive);
         }
+    } else if (config.tbbPartitioner == TbbPartitioner::AUTO && !is_LLM &&
+               (main_cores < config.threads || config.threads == 0)) {
+        // The explicitly requested auto partitioner splits the work into many small chunks which are stolen by the
+        // idle threads, so the main cores don't wait for the slower efficient ones and all the cores can be used
+        config.modelPreferThreadsLatency = main_cores + efficient_cores;
     } else {
         // Fall back to default latency preference logic
         bool use_all_cores = should_use_all_cores_for_latency(main_cores, efficient_cores, int8_intensive);
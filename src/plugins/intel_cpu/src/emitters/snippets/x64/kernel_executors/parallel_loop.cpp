@@ -5,6 +5,7 @@
 #include "parallel_loop.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -21,6 +22,9 @@ static inline uintptr_t* apply_byte_offset(uintptr_t* ptr, size_t offset) {
     return reinterpret_cast<uintptr_t*>(reinterpret_cast<uint8_t*>(ptr) + offset);
 }
 
+// Number of work blocks per thread: enough to balance uneven iterations, few enough to keep the per-block overhead low
+static constexpr int blocks_per_thread = 4;
+
 size_t ParallelLoopConfig::hash() const {
     return dnnl::impl::hash_combine(0, m_increment);
 }
@@ -49,18 +53,24 @@ void ParallelLoopExecutor::execute(const ParallelLoopExecutor* executor, call_ar
                                                                                        : config.get_increment());
     const int num_chunks = static_cast<int>(loop_args->m_work_amount) / increment;
     const int nthr = std::min(parallel_get_max_threads(), num_chunks);
+    // Note: the chunks are claimed dynamically in blocks of `grain` instead of a static split between threads,
+    // so iterations with uneven cost (e.g. causal masks or ragged batches) don't leave threads idle at the tail.
+    // The parallel region may be entered several times per thread: preamble_ptr depends only on its arguments
+    const int grain = std::max(1, num_chunks / std::max(1, nthr * blocks_per_thread));
+    std::atomic<int> next_chunk{0};
 
-    parallel_nt_static(nthr, [&](const int ithr, const int nthr) {
-        int start_chunk = 0, end_chunk = 0;
-        splitter(num_chunks, nthr, ithr, start_chunk, end_chunk);
-
+    parallel_nt_static(nthr, [&]([[maybe_unused]] const int ithr, [[maybe_unused]] const int nthr) {
         std::vector<uintptr_t*> mem_ptrs(num_ptrs);
-        for (int i = 0; i < num_ptrs; i++) {
-            mem_ptrs[i] = apply_byte_offset(stack_ptr[i], loop_args->m_ptr_increments[i] * start_chunk);
-        }
+        for (int start_chunk = next_chunk.fetch_add(grain, std::memory_order_relaxed); start_chunk < num_chunks;
+             start_chunk = next_chunk.fetch_add(grain, std::memory_order_relaxed)) {
+            const int end_chunk = std::min(start_chunk + grain, num_chunks);
+            for (int i = 0; i < num_ptrs; i++) {
+                mem_ptrs[i] = apply_byte_offset(stack_ptr[i], loop_args->m_ptr_increments[i] * start_chunk);
+            }
 
-        const auto internal_seq_loop_work_amount = (end_chunk - start_chunk) * increment;
-        call_args->preamble_ptr(internal_seq_loop_work_amount, reinterpret_cast<void*>(mem_ptrs.data()));
+            const auto internal_seq_loop_work_amount = (end_chunk - start_chunk) * increment;
+            call_args->preamble_ptr(internal_seq_loop_work_amount, reinterpret_cast<void*>(mem_ptrs.data()));
+        }
     });
 
     for (int64_t i = 0; i < num_ptrs; i++) {
@@ -20,6 +20,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -452,7 +453,68 @@ void Graph::InitNodes() {
     }
 }
 
+void Graph::InitDescriptorsParallel() {
+    OV_ITT_SCOPED_TASK(itt::domains::ov_intel_cpu, "Graph::InitDescriptorsParallel");
+    // The supported descriptors of a node only depend on its own attributes and the original precisions of the
+    // neighbours, the descriptors are selected afterwards, so the nodes may be processed independently. The shared
+    // state of the context is guarded: the weights cache is thread safe and the primitive caches are required to be
+    // thread safe (see InitDescriptors). The nodes' getSupportedDescriptors(), initSupportedPrimitiveDescriptors() and
+    // filterSupportedPrimitiveDescriptors() are still expected not to modify the neighbours, which is why the parallel
+    // initialization is experimental and disabled by default (Config::parallelGraphInit).
+    std::exception_ptr error = nullptr;
+    std::mutex errorMutex;
+    m_context->getCpuParallel()->parallel_for(graphNodes.size(), [&](size_t i) {
+        try {
+            const auto& node = graphNodes[i];
+            {
+                OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.getSupportedDescriptors);
+                node->getSupportedDescriptors();
+            }
+            {
+                OV_ITT_SCOPE(FIRST_INFERENCE,
+                             itt::domains::ov_intel_cpu_LT,
+                             node->profiling.initSupportedPrimitiveDescriptors);
+                node->initSupportedPrimitiveDescriptors();
+            }
+            {
+                OV_ITT_SCOPE(FIRST_INFERENCE,
+                             itt::domains::ov_intel_cpu_LT,
+                             node->profiling.filterSupportedPrimitiveDescriptors);
+                node->filterSupportedPrimitiveDescriptors();
+            }
+        } catch (...) {
+            // an exception must not leave the parallel region, so the first one is rethrown afterwards
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    for (auto& node : graphNodes) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.selectOptimalPrimitiveDescriptor);
+        DEBUG_LOG("Select optimal primitive descriptors for node: ", node->getName());
+        node->selectOptimalPrimitiveDescriptor();
+    }
+}
+
 void Graph::InitDescriptors() {
+    if (getConfig().parallelGraphInit) {
+#ifdef CPU_DEBUG_CAPS
+        // the debug capabilities builds stay sequential, so the per node logs of the initialization are kept in order
+        DEBUG_LOG("The parallel initialization of graph ", _name, " is ignored in the debug capabilities build");
+#else
+        // the caches passed by the compiled model are used concurrently only if they are thread safe
+        if (m_context->getParamsCache()->isThreadSafe() && m_context->getSnippetsParamsCache()->isThreadSafe()) {
+            InitDescriptorsParallel();
+            return;
+        }
+#endif
+    }
+
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::ov_intel_cpu_LT, "InitDescriptors", "Prepare");
 
     for (auto& node : graphNodes) {
@@ -1761,6 +1823,25 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
             pc.node_type = node->typeStr;
             perfMap.emplace_back(pc);
 
+            if (getConfig().collectPreparePerfCounters && node->isDynamicNode()) {
+                // the preparation stages are reported as separate records named after the node, fused nodes never
+                // run these stages on their own, so the empty counters are skipped
+                auto addStage = [&](const PerfCount& counter, const char* stage) {
+                    if (counter.count() == 0) {
+                        return;
+                    }
+                    ov::ProfilingInfo stage_pc;
+                    stage_pc.node_name = node->getName() + "::" + stage;
+                    stage_pc.cpu_time = stage_pc.real_time = std::chrono::microseconds(counter.avg());
+                    stage_pc.status = ov::ProfilingInfo::Status::EXECUTED;
+                    stage_pc.exec_type = stage;
+                    stage_pc.node_type = node->typeStr;
+                    perfMap.emplace_back(stage_pc);
+                };
+                addStage(node->ShapeInferPerfCounter(), "shape_infer");
+                addStage(node->PrepareParamsPerfCounter(), "prepare_params");
+            }
+
             for (const auto& fusedNode : node->fusedWith) {
                 getPerfMapFor(perfMap, fusedNode);
             }
@@ -320,6 +320,7 @@ protected:
 
     void InitNodes();
     void InitDescriptors();
+    void InitDescriptorsParallel();
     void ResolveInplaceDirections();
     void InitOptimalPrimitiveDescriptors();
     void ResolveEdgeConflicts();
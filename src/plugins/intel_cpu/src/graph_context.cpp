@@ -27,18 +27,25 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr rtParamsCache,
+                           MultiCachePtr snippetsParamsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      // the nodes initialized in parallel (see Graph::InitDescriptorsParallel) may access the caches concurrently
+      m_rtParamsCache(rtParamsCache ? std::move(rtParamsCache)
+                                    : std::make_shared<MultiCache>(m_config.rtCacheCapacity,
+                                                                   m_config.parallelGraphInit)),
+      m_snippetsParamsCache(snippetsParamsCache ? std::move(snippetsParamsCache)
+                                                : std::make_shared<MultiCache>(m_config.snippetsCacheCapacity,
+                                                                               m_config.parallelGraphInit)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(m_config.dynamicMemoryGrowth)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -37,7 +37,9 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr rtParamsCache = nullptr,
+                 MultiCachePtr snippetsParamsCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -114,7 +116,7 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache, may be shared between the streams if it is thread safe
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
     // global scratch pad
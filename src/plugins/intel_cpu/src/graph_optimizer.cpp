@@ -250,6 +250,9 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph& graph) {
     DropDoubleReorders(graph);
     graph.RemoveDroppedNodes();
 
+    MergeConvertAndReorder(graph);
+    graph.RemoveDroppedNodes();
+
     MergeTransposeAndReorder(graph);
     graph.RemoveDroppedNodes();
 
@@ -2310,6 +2313,70 @@ void GraphOptimizer::DropDoubleReorders(Graph& graph) {
     }
 }
 
+void GraphOptimizer::MergeConvertAndReorder(Graph& graph) {
+    // Convert -> Reorder makes two passes over the tensor, e.g. u8 nhwc input -> f32 nhwc -> f32 nChw16c. The reorder
+    // primitive converts the precision on the fly, so the pair is replaced with a single reorder. Only the conversions
+    // to f32 which are exact are merged, thus the rounding and saturation rules of Convert do not matter. The source
+    // precision must also be representable by oneDNN, since the merged reorder is executed by a oneDNN primitive.
+    auto isSuitableConvert = [](const NodePtr& node) {
+        if (node->getType() != Type::Convert || node->getParentEdges().size() != 1 ||
+            node->getChildEdges().size() != 1 || !node->getFusedWith().empty()) {
+            return false;
+        }
+        const auto* selectedPD = node->getSelectedPrimitiveDescriptor();
+        if (!selectedPD) {
+            return false;
+        }
+        const auto& config = selectedPD->getConfig();
+        return config.outConfs[0].getMemDesc()->getPrecision() == ov::element::f32 &&
+               any_of(config.inConfs[0].getMemDesc()->getPrecision(),
+                      ov::element::u8,
+                      ov::element::i8,
+                      ov::element::f16,
+                      ov::element::bf16);
+    };
+
+    auto isSuitableReorder = [](const NodePtr& node) {
+        if (node->getType() != Type::Reorder || node->getChildEdges().size() != 1) {
+            return false;
+        }
+        auto* reorder = dynamic_cast<Reorder*>(node.get());
+        OPENVINO_ASSERT(reorder, "Cannot get reorder layer ", node->getName());
+        return !reorder->getOptimized() && reorder->getOutput().getPrecision() == ov::element::f32;
+    };
+
+    const auto& nodes = graph.GetNodes();
+    for (size_t i = 0; i < nodes.size(); ++i) {  // NOLINT(modernize-loop-convert)
+        auto convert = nodes[i];
+        if (!isSuitableConvert(convert)) {
+            continue;
+        }
+        auto reorderNode = convert->getChildEdgeAt(0)->getChild();
+        if (!isSuitableReorder(reorderNode)) {
+            continue;
+        }
+        auto* reorder = dynamic_cast<Reorder*>(reorderNode.get());
+        NodePtr p = convert->getParentEdgeAt(0)->getParent();
+        NodePtr c = reorder->getChildEdgeAt(0)->getChild();
+        auto oldEdgeNum = convert->getParentEdgeAt(0)->getInputNum();
+        auto inDesc = convert->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].getMemDesc();
+
+        graph.DropNode(convert);
+        graph.DropNode(reorderNode);
+
+        EdgePtr edge;
+        for (auto& cur : p->getChildEdgesAtPort(oldEdgeNum)) {
+            if (cur->getChild() == c) {
+                edge = cur;
+            }
+        }
+        OPENVINO_ASSERT(edge, "Inappropriate graph processing");
+        std::string layerName = edge->getParent()->getName() + "_ConvertReorder_" + edge->getChild()->getName();
+        graph.InsertReorder(edge, layerName, *inDesc, reorder->getOutput(), false);
+        graph.RemoveEdge(edge);
+    }
+}
+
 void GraphOptimizer::FuseClampAndFakeQuantize(Graph& graph) {
     const auto& graphNodes = graph.GetNodes();
 
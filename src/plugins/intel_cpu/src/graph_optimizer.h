@@ -42,6 +42,7 @@ private:
     static void FuseGatherAndConvert(Graph& graph);
 
     static void DropDoubleReorders(Graph& graph);
+    static void MergeConvertAndReorder(Graph& graph);
     static void FuseConvolutionAndZeroPoints(Graph& graph);
     void FuseBroadcastAndEltwise(Graph& graph);
     static void FuseEltwiseAndSimple(Graph& graph);
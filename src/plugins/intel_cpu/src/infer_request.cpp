@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
@@ -17,6 +18,7 @@
 
 #include "async_infer_request.h"
 #include "compiled_model.h"
+#include "config.h"
 #include "cpu_memory.h"
 #include "cpu_tensor.h"
 #include "cpu_types.h"
@@ -43,7 +45,9 @@
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "proxy_mem_blk.h"
 #include "utils/debug_capabilities.h"
+#include "utils/denormals.hpp"
 #include "utils/general_utils.h"
+#include "utils/warmup_shapes.hpp"
 
 using OvString = ov::element_type_traits<ov::element::string>::value_type;
 
@@ -105,6 +109,13 @@ void SyncInferRequest::infer() {
     auto&& graph = graphLock._graph;
     auto message = ov::threading::message_manager();
 
+    // the denormals mode of the compiled model is applied to the stream thread only while this model is executed,
+    // the workers of the parallel runtime keep their own MXCSR state
+    std::optional<DenormalsScope> denormalsScope;
+    if (graph.getConfig().denormalsOptMode != Config::DenormalsOptMode::DO_Keep) {
+        denormalsScope.emplace(graph.getConfig().denormalsOptMode == Config::DenormalsOptMode::DO_On);
+    }
+
     throw_if_canceled();
     if (m_asyncRequest->m_has_sub_infers) {
         sub_streams_infer();
@@ -145,6 +156,20 @@ void SyncInferRequest::infer() {
     }
 
     graph.PullOutputData(m_outputs);
+
+    if (graph.hasDynamicInput() && m_compiled_model.recordsInputShapes()) {
+        record_input_shapes();
+    }
+}
+
+void SyncInferRequest::record_input_shapes() const {
+    const auto& inputs = get_inputs();
+    WarmupShapes::InputShapes shapes;
+    shapes.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        shapes.push_back(get_tensor(input)->get_shape());
+    }
+    m_compiled_model.recordInputShapes(shapes);
 }
 
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
@@ -228,6 +253,8 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
                 }
                 changeInpPtr(e, it.second);
             }
+        } else {
+            DEBUG_LOG("input ", it.first, " can't be read in place, the user tensor is copied");
         }
     }
 
@@ -269,6 +296,8 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
         } while (previousParent != parent);
         if (canBeInPlace) {
             change_edge_ptr(parentEdge, it.second);
+        } else {
+            DEBUG_LOG("output ", it.first, " can't be written in place, it is copied to the user tensor");
         }
     }
 
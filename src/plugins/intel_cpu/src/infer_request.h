@@ -114,6 +114,7 @@ private:
     void redefine_memory_for_input_nodes(Graph& graph);
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
+    void record_input_shapes() const;
 
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
 
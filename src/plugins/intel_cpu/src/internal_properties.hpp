@@ -20,6 +20,65 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the CPU runtime parameters cache is shared between all the streams of a compiled model instead
+ * of being created per stream. The shared cache is thread safe and builds every record only once.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Defines whether the shared weights of each socket are bound to the memory of the socket NUMA node, so the
+ * packed weights are local to the streams running on it regardless of the thread which has created them.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_weights_numa_placement{"CPU_WEIGHTS_NUMA_PLACEMENT"};
+
+/**
+ * @brief Defines whether the intermediate buffers of the dynamic shape tensors are grown geometrically instead of being
+ * reallocated to the exact size each time a bigger shape is met. The buffers never shrink, so the offsets stay stable.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_dynamic_memory_growth{"CPU_DYNAMIC_MEMORY_GROWTH"};
+
+/**
+ * @brief Defines whether the average time of the dynamic shapes preparation stages (shape inference and
+ * prepareParams, which includes the executor creation and JIT compilation) is collected for each dynamic node. The
+ * stages are reported by get_profiling_info() as separate records named "<node name>::shape_infer" and
+ * "<node name>::prepare_params".
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_profile_preparation{"CPU_PROFILE_PREPARATION"};
+
+/**
+ * @brief Input shape combinations the dynamic graphs are warmed up with, so the runtime primitives and JIT kernels for
+ * these shapes are ready in advance. The first infer request schedules the warm-up on every stream in the background.
+ * The format is the one of the exported warm-up shapes: the input shapes are delimited by ';', the combinations - by
+ * '|', e.g. "1,128|1,512|1,4096".
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_warmup_shapes{"CPU_WARMUP_SHAPES"};
+
+/**
+ * @brief Defines whether the input shape combinations executed by the dynamic graphs are recorded (up to 64) and stored
+ * in the exported model, so the model imported from the cache is warmed up with them. With ov::cache_dir the recorded
+ * shapes are also kept in a file next to the cached blob, since the blob is written before any inference. Enabled by
+ * default only together with ov::cache_dir, since the recording costs a lock and a shapes copy per inference until the
+ * capacity is reached.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_record_warmup_shapes{"CPU_RECORD_WARMUP_SHAPES"};
+
+/**
+ * @brief Defines whether the nodes with several shape dependent executor implementations time all the suitable
+ * implementations on the first executions of each input shapes combination and then use the fastest one instead of the
+ * one with the highest static priority.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_executor_tuning{"CPU_EXECUTOR_TUNING"};
+
+/**
+ * @brief Defines whether the supported primitive descriptors of the graph nodes are initialized in parallel during the
+ * model compilation. It speeds up the compilation of the large models, the descriptors which are selected are the same.
+ * Experimental and disabled by default: it relies on the descriptors initialization of every node type not modifying
+ * the other nodes. The primitive caches of the model are made thread safe for it. Ignored by the builds with the debug
+ * capabilities, so their initialization logs stay ordered.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_parallel_graph_init{"CPU_PARALLEL_GRAPH_INIT"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -69,7 +69,11 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
+    /**
+     * @param growthFactor if greater than one, the buffer is over-allocated by this factor each time it has to grow, so
+     * a monotonically increasing sequence of sizes causes a logarithmic number of reallocations
+     */
+    explicit MemoryBlockWithRelease(float growthFactor = 1.0F) : m_growthFactor(growthFactor) {
         auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
@@ -82,6 +86,10 @@ public:
         m_pBlock->setExtBuff(ptr, size);
     }
     bool resize(size_t size) override {
+        const size_t currentSize = m_pInternalMem->size();
+        if (m_growthFactor > 1.0F && size > currentSize && currentSize > 0) {
+            size = std::max(size, static_cast<size_t>(static_cast<float>(currentSize) * m_growthFactor));
+        }
         return m_pBlock->resize(size);
     }
     [[nodiscard]] bool hasExtBuffer() const noexcept override {
@@ -104,6 +112,7 @@ public:
 private:
     MemoryBlockPtr m_pBlock;
     MemoryBlockWithReuse* m_pInternalMem;
+    float m_growthFactor;
 };
 
 #ifdef CPU_DEBUG_CAPS
@@ -266,6 +275,8 @@ private:
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    explicit MemoryManagerNonOverlappingSets(float growthFactor) : m_growthFactor(growthFactor) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -333,7 +344,7 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block = std::make_shared<MemoryBlockWithRelease>(m_growthFactor);
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
@@ -356,6 +367,7 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    float m_growthFactor;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -525,7 +537,10 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, bool geometricGrowth) : m_id(std::move(id)) {
+    // the dynamic buffers are over-allocated by 50% on growth in the geometric growth mode
+    const float dynamicGrowthFactor = geometricGrowth ? 1.5F : 1.0F;
+
     // init handlers
     m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
         return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
@@ -533,10 +548,12 @@ MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
     }));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        dynamicGrowthFactor));
 
     // handler for I/O tensors, so far simply individual blocks
     m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
@@ -598,7 +615,7 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_geometricGrowth)));
     return m_controlUnits.back();
 }
 
@@ -67,7 +67,7 @@ public:
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, bool geometricGrowth);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -78,9 +78,19 @@ private:
     bool m_allocated = false;
 };
 
+/**
+ * @brief Owns the memory control units of a graph context.
+ * A graph context belongs to a single stream graph, and the infer requests bound to that stream are serialized by the
+ * graph lock, so the solved arenas are already shared by all those requests: a request rents them for the duration of
+ * the inference and only owns its input/output tensors. The units may be released in between with releaseMemory().
+ */
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    /**
+     * @param geometricGrowth defines whether the buffers of the dynamic shape tensors are grown geometrically, which
+     * trades some memory for fewer reallocations when the shapes keep increasing (e.g. sequence length)
+     */
+    explicit NetworkMemoryControl(bool geometricGrowth = false) : m_geometricGrowth(geometricGrowth) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
@@ -94,6 +104,7 @@ public:
 
 private:
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    bool m_geometricGrowth = false;
 };
 
 }  // namespace ov::intel_cpu
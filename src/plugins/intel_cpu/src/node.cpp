@@ -760,6 +760,9 @@ void Node::updateShapes() {
                     getTypeStr(),
                     " with name: ",
                     getName());
+    auto pc = context->getConfig().collectPreparePerfCounters
+                  ? std::make_unique<PerfHelper>(shapeInferPerfCounter)
+                  : nullptr;
     try {
         if (needShapeInfer()) {
             auto result = shapeInfer();
@@ -814,6 +817,9 @@ void Node::updateDynamicParams() {
                           " ",
                           getOriginalLayers());
                 context->getCpuParallel()->activate();
+                auto pc = context->getConfig().collectPreparePerfCounters
+                              ? std::make_unique<PerfHelper>(prepareParamsPerfCounter)
+                              : nullptr;
                 prepareParams();
             }
         }
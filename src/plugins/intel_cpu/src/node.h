@@ -484,6 +484,14 @@ public:
         return perfCounter;
     }
 
+    [[nodiscard]] const PerfCount& ShapeInferPerfCounter() const {
+        return shapeInferPerfCounter;
+    }
+
+    [[nodiscard]] const PerfCount& PrepareParamsPerfCounter() const {
+        return prepareParamsPerfCounter;
+    }
+
     virtual void resolveInPlaceEdges(Edge::LOOK look);
 
     // @todo this supposed to be 'execute + executeImpl' instead of 'executeStatic + execute'
@@ -874,6 +882,9 @@ private:
     int execIndex = -1;
 
     PerfCount perfCounter;
+    // dynamic shapes preparation stages, collected only if Config::collectPreparePerfCounters is set
+    PerfCount shapeInferPerfCounter;
+    PerfCount prepareParamsPerfCounter;
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
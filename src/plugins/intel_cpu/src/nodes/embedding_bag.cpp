@@ -18,8 +18,30 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <xmmintrin.h>
+#endif
+
 namespace ov::intel_cpu::node {
 
+namespace {
+
+// The embedding rows are gathered at data dependent offsets the hardware prefetcher cannot predict, so the row of the
+// next index in the bag is requested while the current one is being accumulated.
+inline void prefetchRow(const void* row, size_t bytes) {
+    constexpr size_t cacheLineSize = 64LU;
+    const auto* ptr = static_cast<const char*>(row);
+    for (size_t offset = 0LU; offset < bytes; offset += cacheLineSize) {
+#if defined(__GNUC__)
+        __builtin_prefetch(ptr + offset, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#endif
+    }
+}
+
+}  // namespace
+
 EmbeddingBag::EmbeddingBag(const std::shared_ptr<ov::Node>& op,
                            size_t requiredInputNum,
                            size_t indicesIdx,
@@ -82,10 +104,17 @@ void EmbeddingBag::processData(const T* srcData,
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
+                auto prefetchNext = [&](size_t idx) {
+                    if (idx + 1 < indicesSize && static_cast<size_t>(indices[idx + 1]) < inDataDims[0]) {
+                        prefetchRow(srcData + indices[idx + 1] * _embDepth, _embDepth * sizeof(T));
+                    }
+                };
+
                 size_t inIdx = 0LU;
                 OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
                                 msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
                 size_t srcIndex = indices[inIdx] * _embDepth;
+                prefetchNext(inIdx);
 
                 if (withWeights) {
                     for (size_t i = 0LU; i < _embDepth; i++) {
@@ -102,6 +131,7 @@ void EmbeddingBag::processData(const T* srcData,
                     OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
                                     msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
                     size_t srcIndex = indices[inIdx] * _embDepth;
+                    prefetchNext(inIdx);
 
                     if (withWeights) {
                         for (size_t i = 0LU; i < _embDepth; i++) {
@@ -526,13 +526,19 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
             auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
 
             OPENVINO_ASSERT(m_gemmImpl, "GEMM implementation is not created");
+            // The GEMM rows are independent, so the padding rows only have to hold finite values: they are zeroed for
+            // the first gathered expert, and afterwards keep the rows of the previous experts. The experts usually get
+            // a small portion of the M tokens, so zeroing the padding for each of them dominated the copy cost.
+            bool padding_initialized = false;
             for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
                 const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
                 if (0 == num_valid_rows) {
                     continue;
                 }
 
-                cpu_parallel->parallel_for(M_size, [&](size_t m) {
+                const size_t rows_to_fill = padding_initialized ? num_valid_rows : M_size;
+                padding_initialized = true;
+                cpu_parallel->parallel_for(rows_to_fill, [&](size_t m) {
                     auto* dst_row = tmp_input_offset(m);
                     if (m < num_valid_rows) {
                         const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
@@ -61,7 +61,8 @@ public:
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
           numNumaNodes(graphContext->getNumNumaNodes()),
-          cpuParallel(graphContext->getCpuParallel()) {
+          cpuParallel(graphContext->getCpuParallel()),
+          executorTuning(graphContext->getConfig().executorTuning) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
         curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
     }
@@ -100,6 +101,10 @@ public:
         return cpuParallel->get_thread_pool();
     }
 
+    [[nodiscard]] bool isExecutorTuningEnabled() const {
+        return executorTuning;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
@@ -113,6 +118,7 @@ private:
     int numNumaNodes;
     int curNumaNodeId = -1;
     std::shared_ptr<CpuParallel> cpuParallel;
+    bool executorTuning = false;
 };
 
 class ExecutorFactoryLegacy {
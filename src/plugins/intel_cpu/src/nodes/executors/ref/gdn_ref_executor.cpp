@@ -47,7 +47,8 @@ bool GdnRefExecutor::updateScratchpad(const MemoryArgs& memory) {
     const auto numWorkerThreads = m_context->getCpuParallel()->get_num_worker_threads();
     auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
         ov::element::f32,
-        ov::intel_cpu::Shape{static_cast<size_t>(numWorkerThreads), 3 * headSize});
+        ov::intel_cpu::Shape{static_cast<size_t>(numWorkerThreads),
+                             (ov::Extensions::Cpu::XARCH::recurrent_linear_attn_v_tile + 2) * headSize});
     m_tmpInpBuffer = m_context->getScratchPad()->createScratchPadMem(newMemDesc);
     m_cachedHeadSize = headSize;
     return m_tmpInpBuffer != nullptr;
@@ -72,7 +73,8 @@ void GdnRefExecutor::execute(const MemoryArgs& memory) {
         const auto numWorkerThreads = m_context->getCpuParallel()->get_num_worker_threads();
         auto newMemDesc = std::make_shared<CpuBlockedMemoryDesc>(
             ov::element::f32,
-            ov::intel_cpu::Shape{static_cast<size_t>(numWorkerThreads), 3 * headSize});
+            ov::intel_cpu::Shape{static_cast<size_t>(numWorkerThreads),
+                                 (ov::Extensions::Cpu::XARCH::recurrent_linear_attn_v_tile + 2) * headSize});
         m_tmpInpBuffer = m_context->getScratchPad()->createScratchPadMem(newMemDesc);
         m_cachedHeadSize = headSize;
     }
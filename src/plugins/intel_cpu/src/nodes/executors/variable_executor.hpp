@@ -4,12 +4,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <utility>
 #include <vector>
 
+#include "cpu_types.h"
 #include "executor.hpp"
 #include "executor_implementation.hpp"
 #include "nodes/executors/graph_emitter.hpp"
@@ -23,6 +27,8 @@ namespace ov::intel_cpu {
  * A stateful (variable) executor
  * Contains two or more executors.
  * Switches between the executors based on provided Memory (more precisely based on in / out shapes)
+ * If the executor tuning is enabled, all the implementations accepting the shapes are timed on the first executions
+ * of each shapes combination and the fastest one is used for the subsequent executions of that combination
  */
 template <typename Attrs>
 class VariableExecutor : public Executor {
@@ -46,6 +52,10 @@ public:
     }
 
     bool update(const MemoryArgs& memory) override {
+        if (m_context->isExecutorTuningEnabled()) {
+            return updateTuned(memory);
+        }
+
         for (auto implId = select(memory, 0); implId < m_suitableImplementations.size();
              implId = select(memory, ++implId)) {
             if (!m_executors[implId]) {
@@ -65,7 +75,26 @@ public:
     }
 
     void execute(const MemoryArgs& memory) override {
+        if (m_tuning.empty()) {
+            m_executors[m_implId]->execute(memory);
+            return;
+        }
+        // the candidates are executed in turns, each execution produces the valid result
+        auto& candidate = m_tuning[m_tuningRun % m_tuning.size()];
+        m_implId = candidate.implId;
+        const auto start = std::chrono::steady_clock::now();
         m_executors[m_implId]->execute(memory);
+        const auto duration = std::chrono::steady_clock::now() - start;
+        candidate.best = std::min(candidate.best, duration);
+
+        if (++m_tuningRun == m_tuning.size() * tuningRunsPerImplementation) {
+            const auto fastest = std::min_element(m_tuning.begin(), m_tuning.end(), [](const auto& a, const auto& b) {
+                return a.best < b.best;
+            });
+            m_implId = fastest->implId;
+            m_decisions[m_tuningKey] = m_implId;
+            m_tuning.clear();
+        }
     }
 
     [[nodiscard]] impl_desc_type implType() const override {
@@ -98,6 +127,61 @@ private:
         return std::distance(m_suitableImplementations.begin(), selectedImplementation);
     }
 
+    static VectorDims shapesKey(const MemoryArgs& memory) {
+        // argument ids are stored along with the dims to keep the key unambiguous
+        std::map<int, MemoryPtr> ordered(memory.begin(), memory.end());
+        VectorDims key;
+        for (const auto& [argId, mem] : ordered) {
+            if (!mem) {
+                continue;
+            }
+            const auto& dims = mem->getStaticDims();
+            key.push_back(static_cast<Dim>(argId));
+            key.push_back(dims.size());
+            key.insert(key.end(), dims.begin(), dims.end());
+        }
+        return key;
+    }
+
+    bool updateTuned(const MemoryArgs& memory) {
+        m_tuning.clear();
+        m_tuningRun = 0;
+        m_tuningKey = shapesKey(memory);
+
+        auto decision = m_decisions.find(m_tuningKey);
+        if (decision != m_decisions.end() && m_executors[decision->second]->update(memory)) {
+            m_implId = decision->second;
+            return true;
+        }
+
+        for (size_t implId = 0; implId < m_suitableImplementations.size(); implId++) {
+            if (!m_suitableImplementations[implId].get().acceptsShapes(m_attrs, memory)) {
+                continue;
+            }
+            if (!m_executors[implId]) {
+                m_executors[implId] = create(implId, memory);
+                if (!m_executors[implId]) {
+                    continue;
+                }
+            }
+            if (m_executors[implId]->update(memory)) {
+                m_tuning.push_back({implId});
+            }
+        }
+
+        if (m_tuning.empty()) {
+            return false;
+        }
+
+        m_implId = m_tuning.front().implId;
+        if (m_tuning.size() == 1) {
+            // nothing to choose from
+            m_decisions[m_tuningKey] = m_implId;
+            m_tuning.clear();
+        }
+        return true;
+    }
+
     ExecutorPtr create(const size_t implId, const MemoryArgs& memory) {
         assert(implId < m_executors.size() && implId < m_suitableImplementations.size());
 
@@ -111,6 +195,18 @@ private:
     // executors cache
     std::vector<ExecutorPtr> m_executors;
     size_t m_implId = 0;
+
+    struct TuningCandidate {
+        size_t implId;
+        std::chrono::steady_clock::duration best = std::chrono::steady_clock::duration::max();
+    };
+
+    // the first run usually includes the cold caches, so the best of several runs is taken
+    static constexpr size_t tuningRunsPerImplementation = 3;
+    std::vector<TuningCandidate> m_tuning;
+    size_t m_tuningRun = 0;
+    VectorDims m_tuningKey;
+    std::map<VectorDims, size_t> m_decisions;
 };
 
 }  // namespace ov::intel_cpu
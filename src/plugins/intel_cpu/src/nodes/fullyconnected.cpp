@@ -5,11 +5,11 @@
 #include "fullyconnected.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <unordered_map>
@@ -316,15 +316,18 @@ void FullyConnected::initTensorParallelSync() {
         tp_cfg.id = tp_cfg.sub_memory->get_memory_id(tp_cfg.w_rank);
         CPU_NODE_ASSERT(tp_cfg.id >= 0, "Tensor Parallel Config ID cannot be negative.");
         tp_cfg.sub_memory->set_memory_used(tp_cfg.id, tp_cfg.w_rank);
+        auto& use_count = tp_cfg.sub_memory->_use_count[tp_cfg.id];
         while (true) {
-            std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
-            if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == tp_cfg.w_size) {
-                tp_cfg.sub_memory->_use_count[tp_cfg.id] = 0;
+            int count = use_count.load(std::memory_order_acquire);
+            // when all the sub-streams are done with the table, exactly one of them resets it
+            if (count == tp_cfg.w_size && use_count.compare_exchange_strong(count, -1, std::memory_order_acq_rel)) {
                 for (int i = 0; i < tp_cfg.w_size; i++) {
-                    tp_cfg.sub_memory->_memorys_table[tp_cfg.id][i].flag = false;
+                    tp_cfg.sub_memory->_memorys_table[tp_cfg.id][i].flag.store(false, std::memory_order_relaxed);
                 }
+                use_count.store(0, std::memory_order_release);
+                break;
             }
-            if (tp_cfg.sub_memory->_use_count[tp_cfg.id] == 0) {
+            if (count == 0) {
                 break;
             }
         }
@@ -364,13 +367,14 @@ void FullyConnected::execTensorParallelSync() {
         const auto strideSize = splited_dim_vec[0] * prec.size();
 
         tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].send_buf = cur_dst->getData();
-        tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].flag = true;
+        tp_cfg.sub_memory->_memorys_table[tp_cfg.id][tp_cfg.w_rank].flag.store(true, std::memory_order_release);
 
         std::vector<int> wait_list(tp_cfg.w_size, 1);
         while (true) {
             int wait_size = 0;
             for (int idx = 0; idx < tp_cfg.w_size; idx++) {
-                if (wait_list[idx] > 0 && tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].flag) {
+                if (wait_list[idx] > 0 &&
+                    tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].flag.load(std::memory_order_acquire)) {
                     auto* new_ptr = static_cast<uint8_t*>(tp_cfg.sub_memory->_memorys_table[tp_cfg.id][idx].send_buf);
                     const auto copySize = splited_dim_vec[idx] * prec.size();  // bytes of half selected dim.
                     const size_t unloop = 8;
@@ -415,10 +419,7 @@ void FullyConnected::execTensorParallelSync() {
                 break;
             }
         }
-        {
-            std::lock_guard<std::mutex> lock(tp_cfg.sub_memory->_flagMutex);
-            tp_cfg.sub_memory->_use_count[tp_cfg.id]++;
-        }
+        tp_cfg.sub_memory->_use_count[tp_cfg.id].fetch_add(1, std::memory_order_acq_rel);
     }
 }
 
@@ -3870,6 +3870,39 @@ void Interpolate::InterpolateRefExecutor::cubicRef(const uint8_t* in_ptr_,
     const auto* in_ptr_f32 = reinterpret_cast<const float*>(in_ptr_);
     auto* out_ptr_f32 = reinterpret_cast<float*>(out_ptr_);
 
+    if (OH > IH) {
+        // Upscaling reads every source row for several output rows, so the filter is applied in two passes: the
+        // horizontal one over the source rows and then the vertical one. The partial sums are the same as in the
+        // direct form below, hence the results are identical.
+        cpu_parallel->parallel_for3d(B, C, IH, [&](size_t n, size_t c, size_t y) {
+            const float* in_ptr_nch = in_ptr_f32 + (IW * IH * C * n + IW * IH * c + IW * y);
+            float* rows_nch = cubicRowsBuf.data() + (OW * IH * C * n + OW * IH * c + OW * y);
+            for (int ox = 0; ox < OW; ox++) {
+                const int ix = xOrigin[ox];
+                float retX = 0.F;
+                for (int x = ix - 1, j = 0; x <= ix + 2; x++, j++) {
+                    int xInRange = std::max(0, std::min(x, IW - 1));
+                    retX += xFactor[ox * CUBIC_GRID_LEN + j] * in_ptr_nch[xInRange];
+                }
+                rows_nch[ox] = retX;
+            }
+        });
+        cpu_parallel->parallel_for3d(B, C, OH, [&](size_t n, size_t c, size_t oy) {
+            const float* rows_nc = cubicRowsBuf.data() + (OW * IH * C * n + OW * IH * c);
+            float* out_ptr_nch = out_ptr_f32 + (OW * OH * C * n + OW * OH * c + OW * oy);
+            const int iy = yOrigin[oy];
+            for (int ox = 0; ox < OW; ox++) {
+                float retY = 0.F;
+                for (int y = iy - 1, i = 0; y <= iy + 2; y++, i++) {
+                    int yInRange = std::max(0, std::min(y, IH - 1));
+                    retY += yFactor[oy * CUBIC_GRID_LEN + i] * rows_nc[OW * yInRange + ox];
+                }
+                out_ptr_nch[ox] = retY;
+            }
+        });
+        return;
+    }
+
     cpu_parallel->parallel_for4d(B, C, OH, OW, [&](size_t n, size_t c, size_t oy, size_t ox) {
         const float* in_ptr_nc = in_ptr_f32 + (IW * IH * C * n + IW * IH * c);
         float* out_ptr_nc = out_ptr_f32 + (OW * OH * C * n + OW * OH * c);
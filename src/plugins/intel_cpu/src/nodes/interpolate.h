@@ -290,7 +290,12 @@ private:
             : InterpolateExecutorBase(interpAttrs, srcDims, dstDims, _dataScales),
               antialias(interpAttrs.antialias),
               dataScales(_dataScales),
-              refInterpAttrs(interpAttrs) {}
+              refInterpAttrs(interpAttrs) {
+            // the horizontal pass output of the separable cubic upscaling, sized once per shape
+            if (mode == InterpolateMode::cubic && dstDim5d[3] > srcDimPad5d[3]) {
+                cubicRowsBuf.resize(srcDimPad5d[0] * srcDimPad5d[1] * srcDimPad5d[3] * dstDim5d[4]);
+            }
+        }
 
         void exec(const uint8_t* in_ptr_,
                   uint8_t* out_ptr_,
@@ -356,6 +361,7 @@ private:
         bool antialias;
         std::vector<float> dataScales;
         InterpolateAttrs refInterpAttrs;
+        std::vector<float> cubicRowsBuf;
     };
 
     void setPostOps(dnnl::primitive_attr& attr, const VectorDims& dims);
@@ -1,6 +1,7 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdint>
@@ -78,6 +79,29 @@ static inline void l2norm(float* a, size_t n, float eps) {
 #endif
 }
 
+// dst += src * scale
+static inline void madd_scalar(float* dst, const float* src, float scale, size_t n) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    __m512 vscale = _mm512_set1_ps(scale);
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        __m512 v = _mm512_loadu_ps(dst + i);
+        v = _mm512_fmadd_ps(_mm512_loadu_ps(src + i), vscale, v);
+        _mm512_storeu_ps(dst + i, v);
+    }
+#elif defined(HAVE_AVX2)
+    __m256 vscale = _mm256_set1_ps(scale);
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(dst + i);
+        v = _mm256_fmadd_ps(_mm256_loadu_ps(src + i), vscale, v);
+        _mm256_storeu_ps(dst + i, v);
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] += src[i] * scale;
+    }
+}
+
 template <typename T>
 static void recurrent_linear_attn_impl(const ov::intel_cpu::PlainTensor& query,
                                        const ov::intel_cpu::PlainTensor& key,
@@ -102,22 +126,29 @@ static void recurrent_linear_attn_impl(const ov::intel_cpu::PlainTensor& query,
     const size_t V_HEAD_DIMS = V;
     const float q_scale = 1 / std::sqrt(static_cast<float>(K_HEAD_DIMS));
     const size_t group_size = v_heads / qk_heads;
-    cpu_parallel->parallel_for3d(B, v_heads, V, [&](size_t i_b, size_t i_h, size_t i_v) {
+    // Each task owns a tile of V columns, so the normalized k/q of a token are prepared once per tile
+    // instead of once per column, and the token loop updates the whole tile of states.
+    const size_t v_tiles = ov::intel_cpu::div_up(V_HEAD_DIMS, recurrent_linear_attn_v_tile);
+    cpu_parallel->parallel_for3d(B, v_heads, v_tiles, [&](size_t i_b, size_t i_h, size_t i_v_tile) {
         size_t tid = parallel_get_thread_num();
-        float* init_state = temp_buffer + tid * 3 * K_HEAD_DIMS;
-        float* b_k = temp_buffer + tid * 3 * K_HEAD_DIMS + K_HEAD_DIMS;
-        float* b_q = temp_buffer + tid * 3 * K_HEAD_DIMS + 2 * K_HEAD_DIMS;
+        float* b_k = temp_buffer + tid * (recurrent_linear_attn_v_tile + 2) * K_HEAD_DIMS;
+        float* b_q = b_k + K_HEAD_DIMS;
+        float* states = b_q + K_HEAD_DIMS;
+        const size_t v_begin = i_v_tile * recurrent_linear_attn_v_tile;
+        const size_t v_count = std::min(recurrent_linear_attn_v_tile, V_HEAD_DIMS - v_begin);
         const size_t hk = i_h / group_size;
         // B, T, qk, K
         T* q_ptr = query.ptr<T>(i_b, 0, hk);
         T* k_ptr = key.ptr<T>(i_b, 0, hk);
         // B, T, v_heads, V
-        T* v_ptr = value.ptr<T>(i_b, 0, i_h);
+        T* v_ptr = value.ptr<T>(i_b, 0, i_h, v_begin);
         // B, v_heads, K, V
         // Load recurrent state with stride V in K dimension
-        T* state_ptr = recurrent_state.ptr<T>(i_b, i_h, 0, i_v);
+        T* state_ptr = recurrent_state.ptr<T>(i_b, i_h, 0, v_begin);
         for (size_t j = 0; j < K_HEAD_DIMS; j++) {
-            init_state[j] = static_cast<float>(state_ptr[j * V_HEAD_DIMS]);
+            for (size_t v = 0; v < v_count; v++) {
+                states[v * K_HEAD_DIMS + j] = static_cast<float>(state_ptr[j * V_HEAD_DIMS + v]);
+            }
         }
 
         for (size_t i = 0; i < timesteps; i++) {
@@ -133,24 +164,27 @@ static void recurrent_linear_attn_impl(const ov::intel_cpu::PlainTensor& query,
                 l2norm(b_q, K_HEAD_DIMS, q_l2_norm_eps);
             }
             multiply_scalar(b_q, b_q, q_scale, K_HEAD_DIMS);
-            // h0 * gate
-            multiply_scalar(init_state, init_state, b_g, K_HEAD_DIMS);
-            float h_k = dot_product(init_state, b_k, K_HEAD_DIMS, nullptr, nullptr, nullptr, 0);
-            // B, T, v_heads, V
-            float b_v = static_cast<float>(v_ptr[i_v + i * v_heads * V_HEAD_DIMS]);
-            b_v -= h_k;
-            // b_v * b_k
-            b_v *= b_beta;
-            multiply_scalar(b_k, b_k, b_v, K_HEAD_DIMS);
-            // h = h0 + update
-            cvt_add(init_state, init_state, b_k, 1, K_HEAD_DIMS, 0, 0, 0);
-            float b_output = dot_product(init_state, b_q, K_HEAD_DIMS, nullptr, nullptr, nullptr, 0);
-            output_attn.at<T>({i_b, i, i_h, i_v}) = static_cast<T>(b_output);
+            T* out_ptr = output_attn.ptr<T>(i_b, i, i_h, v_begin);
+            for (size_t v = 0; v < v_count; v++) {
+                float* state = states + v * K_HEAD_DIMS;
+                // h0 * gate
+                multiply_scalar(state, state, b_g, K_HEAD_DIMS);
+                float h_k = dot_product(state, b_k, K_HEAD_DIMS, nullptr, nullptr, nullptr, 0);
+                // B, T, v_heads, V
+                float b_v = static_cast<float>(v_ptr[v + i * v_heads * V_HEAD_DIMS]);
+                b_v = (b_v - h_k) * b_beta;
+                // h = h0 + b_v * b_k
+                madd_scalar(state, b_k, b_v, K_HEAD_DIMS);
+                float b_output = dot_product(state, b_q, K_HEAD_DIMS, nullptr, nullptr, nullptr, 0);
+                out_ptr[v] = static_cast<T>(b_output);
+            }
         }
         // Store recurrent state with stride V in K dimension
-        T* state_out_ptr = output_recurrent_state.ptr<T>(i_b, i_h, 0, i_v);
+        T* state_out_ptr = output_recurrent_state.ptr<T>(i_b, i_h, 0, v_begin);
         for (size_t j = 0; j < K_HEAD_DIMS; j++) {
-            state_out_ptr[j * V_HEAD_DIMS] = static_cast<T>(init_state[j]);
+            for (size_t v = 0; v < v_count; v++) {
+                state_out_ptr[j * V_HEAD_DIMS + v] = static_cast<T>(states[v * K_HEAD_DIMS + j]);
+            }
         }
     });
 }
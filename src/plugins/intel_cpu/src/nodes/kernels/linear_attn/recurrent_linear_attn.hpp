@@ -10,6 +10,9 @@
 
 namespace ov::Extensions::Cpu::XARCH {
 
+/// Number of value columns whose recurrent states are updated together by recurrent_linear_attn().
+inline constexpr size_t recurrent_linear_attn_v_tile = 8;
+
 /// \brief Computes recurrent linear attention for a contiguous token batch.
 ///
 /// The function consumes query/key/value inputs and recurrent state for the same batch,
@@ -29,7 +32,8 @@ namespace ov::Extensions::Cpu::XARCH {
 /// \param use_qk_l2norm Enables Q/K L2 normalization path.
 /// \param output_attn Output attention tensor [tokens, v_heads, v_head_size].
 /// \param output_recurrent_state Output tensor with updated recurrent state.
-/// \param temp_buffer buffer contains `num_threads * 3 * qk_head_size * sizeof(float)` bytes, 64-byte aligned.
+/// \param temp_buffer buffer contains
+/// `num_threads * (recurrent_linear_attn_v_tile + 2) * qk_head_size * sizeof(float)` bytes, 64-byte aligned.
 /// \param cpu_parallel CPU parallel runtime used for threading/work split.
 void recurrent_linear_attn(const ov::intel_cpu::PlainTensor& query,
                            const ov::intel_cpu::PlainTensor& key,
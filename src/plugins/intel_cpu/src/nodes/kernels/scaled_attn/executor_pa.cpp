@@ -1291,7 +1291,7 @@ struct MHAHelper {
     }
 #    endif
 
-    // compute one token, loop along batch and head dimensions
+    // compute one token (or a few tokens, which are causal to each other), loop along batch and head dimensions
     // all tensors such as query... have no batch dimension because batch dimension is varying
     //  query: [H, L, S]
     //  present_*: [block_number, H, 32, S]
@@ -1312,7 +1312,8 @@ struct MHAHelper {
                             const PlainTensor& alibi_slopes,
                             float* score_output,
                             const PlainTensor& sinks,
-                            size_t q_token_start = 0) {
+                            size_t q_token_start = 0,
+                            const QueryToQueryBiasInfo* query_to_query_info_ptr = nullptr) {
 #    if defined(OPENVINO_ARCH_X86_64)
         if (any_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
             _gemv->tile_config();
@@ -1363,9 +1364,18 @@ struct MHAHelper {
         for (size_t pq = 0; pq < q_len; pq++) {
             for (size_t h = hq_beg; h < hq_end; h++) {
                 // apply attention mask & sofmax
-                const auto ncausal = get_ncausal(q_token_start + pq, cur_kv_len, cur_kv_len);
+                const auto past_len = cur_kv_len - q_len;
+                const auto causal_pos = past_len + pq + 1;
+                const auto ncausal = get_ncausal(q_token_start + pq, causal_pos, cur_kv_len);
                 float* score = _weight.ptr<float>(ithr, h - hq_beg, pq);
                 OPENVINO_DEBUG_ASSERT(score != nullptr, "PagedAttention: _weight buffer must be allocated");
+                if (query_to_query_info_ptr != nullptr) {
+                    for (size_t key_idx = past_len; key_idx < cur_kv_len; key_idx++) {
+                        if (query_to_query_is_masked(query_to_query_info_ptr, pq, key_idx, past_len)) {
+                            score[key_idx] = -FLT_MAX;
+                        }
+                    }
+                }
 
                 float* alibi_lookup = nullptr;
                 float alibi_slope = 0.F;
@@ -1378,7 +1388,7 @@ struct MHAHelper {
                     sink = &sinks.at<float>({0, h, 0, 0}, true);
                 }
                 if (_sliding_window) {
-                    const auto start_idx = get_sliding_start_idx(q_token_start + pq, cur_kv_len);
+                    const auto start_idx = get_sliding_start_idx(q_token_start + pq, causal_pos);
                     const size_t new_causal = ncausal - start_idx;
                     float* sw_alibi_lookup = nullptr;
                     attn_softmax_kernel<float>(score + start_idx,
@@ -1711,6 +1721,9 @@ struct MHA {
 
     WorkItems _workitems;
 
+    // max q_len handled by exec_kernel_one_bh without the kv cache reordering
+    static constexpr size_t small_q_len_max = 16;
+
     MHA(MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& helper) : _helper(helper) {}
 
     // one loop to handle first and second tokens
@@ -1891,6 +1904,36 @@ struct MHA {
                     score_output,
                     sinks,
                     static_cast<size_t>(batch_in_token));
+            } else if (q_len <= _workitems.get_small_q_len()) {
+                // a few tokens, e.g. speculative decoding verification: reading the kv cache directly is cheaper than
+                // reordering the whole kv cache of the sequence for brgemm
+                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + q_len;
+                PlainTensor sub_query;
+                sub_query.resize({q_len, _helper.H, _helper.S}, q.ptr<DATA_TYPE>(batch_in_token));
+                sub_query = sub_query.permute({1, 0, 2});
+
+                QueryToQueryBiasInfo* query_to_query_info_ptr = nullptr;
+                if (_helper._qq_bias && static_cast<size_t>(batch_in_seq) < _helper._qq_bias_infos.size()) {
+                    query_to_query_info_ptr = &_helper._qq_bias_infos[batch_in_seq];
+                }
+                _helper.exec_kernel_one_bh(
+                    sub_query,
+                    k_cache,
+                    v_cache,
+                    output_emb.slice(0, batch_in_token, batch_in_token + q_len)
+                        .reshape({q_len, _helper.H * _helper.SV}),
+                    block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[batch_in_seq],
+                    ithr,
+                    hq_beg,
+                    hq_end,
+                    hk,
+                    q_len,
+                    cur_kv_len,
+                    alibi_slopes,
+                    nullptr,
+                    sinks,
+                    static_cast<size_t>(batch_in_token),
+                    query_to_query_info_ptr);
             } else {
                 const auto batch_in_reorder = item.batch_in_reorder;
                 const auto q_blk = item.q_block_id;
@@ -2042,8 +2085,17 @@ struct MHA {
                     const std::vector<PlainTensor>& sparse_attention_mask,
                     const PlainTensor& qq_bias,
                     const PlainTensor& qq_bias_begins) {
-        _workitems
-            .reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, _helper._block_size);
+        // the score output and the sparse attention are only supported by the reordered path for q_len > 1
+        const size_t small_q_len = output_score || !sparse_attention_mask.empty()
+                                       ? 1
+                                       : std::min(_helper._block_size, small_q_len_max);
+        _workitems.reset(query,
+                         past_lens,
+                         subsequence_begins,
+                         block_indices,
+                         block_indices_begins,
+                         _helper._block_size,
+                         small_q_len);
         if (output_score) {
             _helper.init_score_buffers(past_lens, subsequence_begins, score_aggregation_window);
         }
@@ -2054,7 +2106,8 @@ struct MHA {
         }
         auto nthr = static_cast<size_t>(parallel_get_max_threads());
 
-        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0) {
+        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0 ||
+            _workitems.get_max_small_q_len() > 1) {
             exec_loop_mixed(query,
                             present_key,
                             present_value,
@@ -5,6 +5,7 @@
 
 #include <xbyak/xbyak.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <openvino/core/type/element_type.hpp>
@@ -83,30 +84,41 @@ private:
     int32_t max_kv_len_in_reorder = 0;  // max kv len between first tokens
     int32_t max_batch_in_reorder = 0;
     int32_t total_kv_len = 0;
+    int32_t small_q_len = 1;        // sequences up to this length read the kv cache directly, without reordering
+    int32_t max_small_q_len = 0;    // max q len between such sequences
 
 public:
+    /**
+     * @param small_q_len the sequences with q_len up to this value are handled as the second token ones, i.e. without
+     * the kv cache reordering which is only paid off for the long queries (e.g. speculative decoding verification of
+     * several draft tokens falls into this range)
+     */
     void reset([[maybe_unused]] const ov::intel_cpu::PlainTensor& query,
                const ov::intel_cpu::PlainTensor& past_lens,
                const ov::intel_cpu::PlainTensor& subsequence_begins,
                const ov::intel_cpu::PlainTensor& block_indices,
                const ov::intel_cpu::PlainTensor& block_indices_begins,
-               size_t block_size) {
+               size_t block_size,
+               size_t small_q_len = 1) {
         attn_items.clear();
         reorder_items.clear();
         max_kv_len_in_reorder = 0;
         max_batch_in_reorder = 0;
         total_kv_len = 0;
+        this->small_q_len = static_cast<int32_t>(std::max(small_q_len, size_t{1}));
+        max_small_q_len = 0;
         auto seq_cout = static_cast<int32_t>(past_lens.m_dims[0]);
         for (int32_t i = 0; i < seq_cout; i++) {
             auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
             auto kv_len = past_lens.ptr<int32_t>()[i] + q_len;
             auto kv_len_in_block = static_cast<int32_t>(ov::intel_cpu::div_up(kv_len, block_size));
-            if (q_len == 1) {
-                attn_items.emplace_back(AttnWorkItem{0,     // batch_in_reorder
-                                                     i,     // batch_in_seq
-                                                     1ULL,  // q_len
+            if (q_len <= this->small_q_len) {
+                attn_items.emplace_back(AttnWorkItem{0,      // batch_in_reorder
+                                                     i,      // batch_in_seq
+                                                     q_len,  // q_len
                                                      // kv_len in blocks, used in the sort function
                                                      kv_len_in_block - 1});
+                max_small_q_len = std::max(max_small_q_len, q_len);
             } else {
                 auto reorder_sub_work_count = kv_len_in_block;
                 max_kv_len_in_reorder = std::max(max_kv_len_in_reorder, kv_len);
@@ -157,6 +169,12 @@ public:
     [[nodiscard]] size_t get_total_kv_len() const {
         return static_cast<size_t>(total_kv_len);
     }
+    [[nodiscard]] size_t get_small_q_len() const {
+        return static_cast<size_t>(small_q_len);
+    }
+    [[nodiscard]] size_t get_max_small_q_len() const {
+        return static_cast<size_t>(max_small_q_len);
+    }
 };
 
 #ifdef OPENVINO_ARCH_X86_64
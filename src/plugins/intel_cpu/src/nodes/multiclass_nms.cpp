@@ -516,13 +516,16 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             const float* scoresPtr =
                 slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
+            std::vector<boxInfo> candidates;
             int cur_numBoxes = shared ? static_cast<int>(m_numBoxes) : roisnum[batch_idx];
             for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
                 if (scoresPtr[box_idx] >= m_scoreThreshold) {  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                    candidates.emplace_back(boxInfo({scoresPtr[box_idx], box_idx, 0}));
                 }
             }
+            // the heap is built from all the candidates at once in linear time
+            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less,
+                                                                                             std::move(candidates));
             fb.reserve(sorted_boxes.size());
             if (!sorted_boxes.empty()) {
                 auto adaptive_threshold = m_iouThreshold;
@@ -645,11 +648,18 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (!sorted_boxes.empty()) {
-                parallel_sort(sorted_boxes.begin(),
-                              sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                  return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                              });
+                auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                };
+                // only the top m_nmsRealTopk candidates are visited below, the order is total so the result is the same
+                if (static_cast<size_t>(m_nmsRealTopk) < sorted_boxes.size()) {
+                    std::partial_sort(sorted_boxes.begin(),
+                                      sorted_boxes.begin() + m_nmsRealTopk,
+                                      sorted_boxes.end(),
+                                      greater);
+                } else {
+                    parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), greater);
+                }
                 auto offset = static_cast<int>(batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk);
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first,
                                                         static_cast<int>(batch_idx),
@@ -384,13 +384,14 @@ void NonMaxSuppression::nmsWithSoftSigma(const float* boxes,
         const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(
-            less);  // score, box_id, suppress_begin_index
+        std::vector<boxInfo> candidates;
         for (int box_idx = 0; box_idx < static_cast<int>(m_boxes_num); box_idx++) {
             if (scoresPtr[box_idx] > m_score_threshold) {
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                candidates.emplace_back(boxInfo({scoresPtr[box_idx], box_idx, 0}));
             }
         }
+        // score, box_id, suppress_begin_index; the heap is built from all the candidates at once in linear time
+        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less, std::move(candidates));
         size_t sorted_boxes_size = sorted_boxes.size();
         size_t maxSeletedBoxNum = std::min(sorted_boxes_size, m_output_boxes_per_class);
         selectedBoxes.reserve(maxSeletedBoxNum);
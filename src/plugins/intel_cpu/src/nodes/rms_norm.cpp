@@ -29,6 +29,13 @@
 #    include "cpu_parallel.hpp"
 #    include "kernels/x64/rms_kernel.hpp"
 #    include "nodes/kernels/x64/jit_kernel_base.hpp"
+#elif defined(OPENVINO_ARCH_ARM64)
+#    include <arm_neon.h>
+
+#    include <cmath>
+
+#    include "cpu_parallel.hpp"
+#    include "openvino/core/type/float16.hpp"
 #endif
 
 #include <string>
@@ -123,6 +130,100 @@ private:
     ov::element::Type m_precision;
     std::shared_ptr<kernel::JitKernelBase> m_kernel;
 };
+#elif defined(OPENVINO_ARCH_ARM64)
+static inline float32x4_t rms_load(const float* src) {
+    return vld1q_f32(src);
+}
+
+static inline float32x4_t rms_load(const ov::float16* src) {
+    return vcvt_f32_f16(vld1_f16(reinterpret_cast<const float16_t*>(src)));
+}
+
+static inline void rms_store(float* dst, float32x4_t v) {
+    vst1q_f32(dst, v);
+}
+
+static inline void rms_store(ov::float16* dst, float32x4_t v) {
+    vst1_f16(reinterpret_cast<float16_t*>(dst), vcvt_f16_f32(v));
+}
+
+// NEON counterpart of jit_rms_kernel, the accumulation and the normalization are done in f32
+template <typename T>
+static void rms_norm_row(const T* src, T* dst, const float* scale, size_t data_size, size_t scale_size, float eps) {
+    constexpr size_t vec_size = 4;
+    float32x4_t acc = vdupq_n_f32(0.0F);
+    size_t i = 0;
+    for (; i + vec_size <= data_size; i += vec_size) {
+        const auto x = rms_load(src + i);
+        acc = vfmaq_f32(acc, x, x);
+    }
+    float sum = vaddvq_f32(acc);
+    for (; i < data_size; i++) {
+        const auto x = static_cast<float>(src[i]);
+        sum += x * x;
+    }
+
+    // 1 / sqrt(mean(x^2)+eps), the reciprocal square root estimate is not accurate enough here
+    float rsqrt = 1.0F / std::sqrt(sum / static_cast<float>(data_size) + eps);
+    if (scale_size == 1) {
+        rsqrt *= scale[0];
+    }
+    const auto vec_rsqrt = vdupq_n_f32(rsqrt);
+    for (i = 0; i + vec_size <= data_size; i += vec_size) {
+        auto x = vmulq_f32(rms_load(src + i), vec_rsqrt);
+        if (scale_size != 1) {
+            x = vmulq_f32(x, vld1q_f32(scale + i));
+        }
+        rms_store(dst + i, x);
+    }
+    for (; i < data_size; i++) {
+        auto x = static_cast<float>(src[i]) * rsqrt;
+        if (scale_size != 1) {
+            x *= scale[i];
+        }
+        dst[i] = static_cast<T>(x);
+    }
+}
+
+struct RMSNorm::RMSNormExecutor : public RMSNorm::Executor {
+    RMSNormExecutor(ov::element::Type precision, size_t data_size, size_t scale_size, float eps)
+        : m_precision(precision),
+          m_data_size(data_size),
+          m_scale_size(scale_size),
+          m_eps(eps) {}
+    void execute(const std::vector<MemoryPtr>& inputs,
+                 const MemoryPtr output,
+                 const CpuParallelPtr& cpu_parallel) override {
+        if (m_precision == ov::element::f16) {
+            execute<ov::float16>(inputs, output, cpu_parallel);
+        } else {
+            execute<float>(inputs, output, cpu_parallel);
+        }
+    }
+
+private:
+    template <typename T>
+    void execute(const std::vector<MemoryPtr>& inputs, const MemoryPtr& output, const CpuParallelPtr& cpu_parallel) {
+        const auto* src = inputs[0]->getDataAs<const T>();
+        auto* dst = output->getDataAs<T>();
+        const auto* scale = inputs[1]->getDataAs<const float>();
+
+        const auto& src_strides = inputs[0]->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const auto& dst_strides = output->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        const auto& shape = inputs[0]->getStaticDims();
+        const auto src_stride = src_strides[src_strides.size() - 2];
+        const auto dst_stride = dst_strides[dst_strides.size() - 2];
+        auto n = shape_size(shape) / shape[shape.size() - 1];
+        cpu_parallel->parallel_for(n, [&](size_t i) {
+            rms_norm_row(src + i * src_stride, dst + i * dst_stride, scale, m_data_size, m_scale_size, m_eps);
+        });
+    }
+
+    ov::element::Type m_precision;
+    size_t m_data_size;
+    size_t m_scale_size;
+    float m_eps;
+};
 #endif  // OPENVINO_ARCH_X86_64
 
 RMSNorm::RMSNorm(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
@@ -140,11 +241,21 @@ void RMSNorm::initSupportedPrimitiveDescriptors() {
         return;
     }
     auto precision = getOriginalInputPrecisionAtPort(0);
+#if defined(OPENVINO_ARCH_ARM64)
+    if (none_of(precision, ov::element::f32, ov::element::f16)) {
+        precision = ov::element::f32;
+    }
+#else
     if (none_of(precision, ov::element::f32, ov::element::bf16, ov::element::f16)) {
         precision = ov::element::f32;
     }
+#endif
 
     auto impl_type = [&]() {
+#if defined(OPENVINO_ARCH_ARM64)
+        // the NEON executor, which is always available on AArch64
+        return impl_desc_type::jit_asimd;
+#else
         if (mayiuse(cpu::x64::avx512_core)) {
             return impl_desc_type::jit_avx512;
         }
@@ -152,6 +263,7 @@ void RMSNorm::initSupportedPrimitiveDescriptors() {
             return impl_desc_type::jit_avx2;
         }
         return impl_desc_type::ref;
+#endif
     }();
 
     addSupportedPrimDesc({{LayoutType::ncsp, precision}, {LayoutType::ncsp, ov::element::f32}},
@@ -168,7 +280,7 @@ void RMSNorm::createPrimitive() {
     RMSNormKey key = {precision, data_size, scale_size, m_eps};
 
     auto builder = [&]([[maybe_unused]] const RMSNormKey& key) -> std::shared_ptr<Executor> {
-#ifdef OPENVINO_ARCH_X86_64
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
         return std::make_shared<RMSNormExecutor>(precision, data_size, scale_size, m_eps);
 #else
         return nullptr;
@@ -196,10 +308,12 @@ bool RMSNorm::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, st
     try {
         const auto rms = ov::as_type_ptr<const ov::op::internal::RMS>(op);
         if (rms) {
+#if !defined(OPENVINO_ARCH_ARM64)
             if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
                 errorMessage = "RMSNorm needs avx2+.";
                 return false;
             }
+#endif
             // check the last dimension of data
             auto data_pshape = op->input_value(0).get_partial_shape();
             if (data_pshape.rank().is_dynamic()) {
@@ -149,22 +149,23 @@ void STFT::execute([[maybe_unused]] const dnnl::stream& strm) {
         dst = dst_mem->getDataAs<float>();
     }
 
+    // All the frames share the same size, so the twiddles are generated once for the whole signal
+    const auto twiddles =
+        rdft_executor->generateTwiddles({static_cast<int>(frame_size)}, fft_out_shape, {0}, cpu_parallel);
     cpu_parallel->parallel_for2d(batch_size, num_frames, [&](size_t batch, size_t frame_idx) {
         size_t batch_in_start = batch * signal_length;
         size_t batch_frames_out = batch * num_frames;
 
         const auto frame_start = batch_in_start + frame_idx * frame_step;
         const auto frame_end = frame_start + frame_size;
-        std::vector<float> signal_slice(signal + frame_start, signal + frame_end);
-        std::transform(signal_slice.begin(),
-                       signal_slice.end(),
+        std::vector<float> signal_slice(frame_size_dim);
+        std::transform(signal + frame_start,
+                       signal + frame_end,
                        pad_window.begin(),
                        signal_slice.begin(),
                        std::multiplies<>());
 
         const auto result_idx = (batch_frames_out + frame_idx) * fft_out_shape_size;
-        auto twiddles =
-            rdft_executor->generateTwiddles({static_cast<int>(signal_slice.size())}, fft_out_shape, {0}, cpu_parallel);
         rdft_executor->execute(signal_slice.data(),
                                dst + result_idx,
                                twiddles,
@@ -4,6 +4,7 @@
 
 #include "string_tensor_unpack.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -23,7 +24,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_unpack.hpp"
-#include "openvino/reference/string_tensor_unpack.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 
 namespace ov::intel_cpu::node {
@@ -87,10 +87,19 @@ void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
 
 void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
-    ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
-                                        getDstDataAtPortAs<int32_t>(0),
-                                        getDstDataAtPortAs<int32_t>(1),
-                                        getDstDataAtPortAs<uint8_t>(2),
-                                        stringCount);
+    const auto* data = getSrcDataAtPortAs<const std::string>(0);
+    auto* outBegins = getDstDataAtPortAs<int32_t>(0);
+    auto* outEnds = getDstDataAtPortAs<int32_t>(1);
+    auto* outSymbols = getDstDataAtPortAs<uint8_t>(2);
+    // the offsets are a cheap sequential prefix sum, once they are known the symbols are copied in parallel
+    int32_t offset = 0;
+    for (size_t i = 0; i < stringCount; ++i) {
+        outBegins[i] = offset;
+        offset += static_cast<int32_t>(data[i].length());
+        outEnds[i] = offset;
+    }
+    context->getCpuParallel()->parallel_for(stringCount, [&](size_t i) {
+        std::copy(data[i].begin(), data[i].end(), outSymbols + outBegins[i]);
+    });
 }
 }  // namespace ov::intel_cpu::node
@@ -22,6 +22,7 @@
 #include "node.h"
 #include "nodes/executors/subgraph.hpp"
 #include "nodes/node_config.h"
+#include "onednn/dnnl.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
@@ -727,7 +728,8 @@ Subgraph::getControlFlowPasses() {  // NOLINT(readability-convert-member-functio
 
     SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(Place::After,
                                            ov::snippets::lowered::pass::MarkLoops,
-                                           ov::intel_cpu::pass::BrgemmCPUBlocking);
+                                           ov::intel_cpu::pass::BrgemmCPUBlocking,
+                                           dnnl::utils::get_cache_size(2, true));
     SNIPPETS_REGISTER_PASS_RELATIVE_ARM64(Place::After,
                                           ov::snippets::lowered::pass::MarkLoops,
                                           ov::intel_cpu::pass::GemmCPUBlocking);
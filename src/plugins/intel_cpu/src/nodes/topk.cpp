@@ -17,6 +17,7 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/topk.hpp"
@@ -2039,8 +2041,8 @@ bool TopK::needPrepareParams() const {
 
 void TopK::preset_params() {
     auto* selectedPD = getSelectedPrimitiveDescriptor();
-    auto data_type = DnnlExtensionUtils::ElementTypeToDataType(
-        selectedPD->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision());
+    data_precision = selectedPD->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision();
+    auto data_type = DnnlExtensionUtils::ElementTypeToDataType(data_precision);
     data_size = DnnlExtensionUtils::sizeOfDataType(data_type);
 
     topk_innermost =
@@ -2103,6 +2105,21 @@ void TopK::prepareParams() {
 
         axis_dim = src_dims[axis];
 
+        // The kernels are parallelized over the rows only, so a huge innermost axis with a few rows (e.g. sampling
+        // over LLM logits) keeps most of the threads idle. In such a case the axis is split between the threads,
+        // each part is reduced to its own top k and the partial results are merged.
+        axis_split = 1;
+        if ((layout == TopKLayoutType::topk_ncsp || layout == TopKLayoutType::topk_nspc) && topk_innermost && I == 1) {
+            const auto nthr = static_cast<size_t>(context->getCpuParallel()->get_num_threads());
+            const size_t min_chunk = std::max(static_cast<size_t>(top_k) * 16, static_cast<size_t>(4096));
+            if (O < nthr) {
+                axis_split = std::max(static_cast<size_t>(1), std::min(nthr / O, axis_dim / min_chunk));
+            }
+        }
+        if (axis_split > 1) {
+            vec_split_idx.resize(O * axis_split * top_k);
+        }
+
         // [case 1]: if 2 * (top_k + 1) + 2 <= count_xmm, thus top_k is small enough that the vector registers are
         // sufficient
         //           to keep all necessary data for sorting, no need to load and store frequently, use inplace bubble
@@ -2252,7 +2269,99 @@ void TopK::execute([[maybe_unused]] const dnnl::stream& strm) {
     }
 }
 
+namespace {
+// TopK output order: by value according to the mode, the smaller index goes first among equal values
+template <typename T>
+struct TopKSplitOrder {
+    using value_type = std::conditional_t<std::is_same_v<T, ov::bfloat16>, float, T>;
+
+    const T* row;
+    bool mode_max;
+
+    bool operator()(int32_t a, int32_t b) const {
+        const auto va = static_cast<value_type>(row[a]);
+        const auto vb = static_cast<value_type>(row[b]);
+        if (va != vb) {
+            return mode_max ? va > vb : va < vb;
+        }
+        return a < b;
+    }
+};
+}  // namespace
+
+template <typename T>
+void TopK::topk_split_axis_process(const T* in_ptr, T* out_ptr, int32_t* out_idx_ptr) {
+    const auto& cpu_parallel = context->getCpuParallel();
+    const auto k = static_cast<size_t>(top_k);
+    const size_t chunk = div_up(axis_dim, axis_split);
+
+    // every part keeps a heap of its k best indices with the worst of them on top, so most of the elements are
+    // rejected by a single comparison against the top
+    cpu_parallel->parallel_for2d(O, axis_split, [&](size_t o, size_t s) {
+        const TopKSplitOrder<T> order{in_ptr + o * axis_dim, mode_max};
+        int32_t* heap = vec_split_idx.data() + (o * axis_split + s) * k;
+        const size_t begin = std::min(s * chunk, axis_dim);
+        const size_t end = std::min(begin + chunk, axis_dim);
+        size_t heap_size = 0;
+        for (size_t i = begin; i < end; i++) {
+            const auto idx = static_cast<int32_t>(i);
+            if (heap_size < k) {
+                heap[heap_size++] = idx;
+                std::push_heap(heap, heap + heap_size, order);
+            } else if (order(idx, heap[0])) {
+                std::pop_heap(heap, heap + k, order);
+                heap[k - 1] = idx;
+                std::push_heap(heap, heap + k, order);
+            }
+        }
+        std::fill(heap + heap_size, heap + k, -1);
+    });
+
+    cpu_parallel->parallel_for(O, [&](size_t o) {
+        const TopKSplitOrder<T> order{in_ptr + o * axis_dim, mode_max};
+        int32_t* candidates = vec_split_idx.data() + o * axis_split * k;
+        int32_t* candidates_end = std::remove(candidates, candidates + axis_split * k, -1);
+        std::partial_sort(candidates, candidates + k, candidates_end, order);
+        if (sort_index) {
+            std::sort(candidates, candidates + k);
+        }
+        for (size_t j = 0; j < k; j++) {
+            out_ptr[o * k + j] = order.row[candidates[j]];
+            out_idx_ptr[o * k + j] = candidates[j];
+        }
+    });
+}
+
 void TopK::topk_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr) {
+    if (axis_split > 1) {
+        auto* idx_ptr = reinterpret_cast<int32_t*>(out_idx_ptr);
+        switch (data_precision) {
+        case ov::element::f32:
+            topk_split_axis_process(reinterpret_cast<const float*>(in_ptr), reinterpret_cast<float*>(out_ptr), idx_ptr);
+            return;
+        case ov::element::bf16:
+            topk_split_axis_process(reinterpret_cast<const ov::bfloat16*>(in_ptr),
+                                    reinterpret_cast<ov::bfloat16*>(out_ptr),
+                                    idx_ptr);
+            return;
+        case ov::element::i32:
+            topk_split_axis_process(reinterpret_cast<const int32_t*>(in_ptr),
+                                    reinterpret_cast<int32_t*>(out_ptr),
+                                    idx_ptr);
+            return;
+        case ov::element::i8:
+            topk_split_axis_process(reinterpret_cast<const int8_t*>(in_ptr),
+                                    reinterpret_cast<int8_t*>(out_ptr),
+                                    idx_ptr);
+            return;
+        case ov::element::u8:
+            topk_split_axis_process(in_ptr, out_ptr, idx_ptr);
+            return;
+        default:
+            break;
+        }
+    }
+
     const auto& cpu_parallel = context->getCpuParallel();
     uint8_t* process_ptr = vec_process_ptr.data();
     uint8_t* process_idx_ptr = vec_process_idx_ptr.data();
@@ -101,6 +101,8 @@ public:
 
 private:
     void topk_process(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr);
+    template <typename T>
+    void topk_split_axis_process(const T* in_ptr, T* out_ptr, int32_t* out_idx_ptr);
     void topk_ref(const float* in_ptr, float* out_ptr, int32_t* dst_idx);
     inline void topk_kernel_process(const uint8_t* in_p,
                                     uint8_t* out_p,
@@ -138,6 +140,8 @@ private:
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
     bool preset_params_done = false;
+    ov::element::Type data_precision = ov::element::f32;
+    size_t axis_split = 1;
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
@@ -151,6 +155,7 @@ private:
 
     std::vector<uint8_t> vec_process_ptr;
     std::vector<uint8_t> vec_process_idx_ptr;
+    std::vector<int32_t> vec_split_idx;
 
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel = nullptr;
 };
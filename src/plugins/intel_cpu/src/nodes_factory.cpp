@@ -127,6 +127,7 @@
 #if defined(OPENVINO_ARCH_ARM64)
 #    include "nodes/fake_quantize.h"
 #    include "nodes/paged_attn.h"
+#    include "nodes/rms_norm.h"
 #endif
 
 namespace ov::intel_cpu {
@@ -261,6 +262,7 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
 #elif defined(OPENVINO_ARCH_ARM64)
     INTEL_CPU_NODE(FakeQuantize, Type::FakeQuantize);
     INTEL_CPU_NODE(PagedAttention, Type::PagedAttention);
+    INTEL_CPU_NODE(RMSNorm, Type::RMS);
 #endif
 }
 
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <istream>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -412,14 +413,17 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
 
     // SSE runtime check is needed for some ATOM machine, which is x86-64 but w/o SSE
     static Xbyak::util::Cpu cpu;
-    if (cpu.has(Xbyak::util::Cpu::tSSE)) {
-        if (conf.denormalsOptMode == Config::DenormalsOptMode::DO_On) {
-            flush_to_zero(true);
-            conf.DAZOn = denormals_as_zero(true);
-        } else if (conf.denormalsOptMode == Config::DenormalsOptMode::DO_Off) {
-            flush_to_zero(false);
-            denormals_as_zero(false);
-        }
+    if (!cpu.has(Xbyak::util::Cpu::tSSE)) {
+        conf.denormalsOptMode = Config::DenormalsOptMode::DO_Keep;
+    }
+    // The denormals mode is applied to the calling thread while the compiled model and its executors are created and
+    // to the stream threads running the inference (see SyncInferRequest::infer). It is restored afterwards, so it does
+    // not leak to the other models used by the application threads. The workers of the parallel runtime are not
+    // switched per model.
+    std::optional<DenormalsScope> denormalsScope;
+    if (conf.denormalsOptMode != Config::DenormalsOptMode::DO_Keep) {
+        denormalsScope.emplace(conf.denormalsOptMode == Config::DenormalsOptMode::DO_On);
+        conf.DAZOn = conf.denormalsOptMode == Config::DenormalsOptMode::DO_On && denormalsScope->daz();
     }
     return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
 }
@@ -548,6 +552,10 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         return decltype(ov::enable_weightless)::value_type{engConfig.enableWeightless};
     }
 
+    if (name == ov::cache_dir) {
+        return decltype(ov::cache_dir)::value_type{engConfig.cacheDir};
+    }
+
     return get_ro_property(name, options);
 }
 
@@ -600,7 +608,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::value_cache_precision.name()),
                                                    RW_property(ov::key_cache_group_size.name()),
                                                    RW_property(ov::value_cache_group_size.name()),
-                                                   RW_property(ov::enable_weightless.name())};
+                                                   RW_property(ov::enable_weightless.name()),
+                                                   RW_property(ov::cache_dir.name())};
 
         std::vector<ov::PropertyName> wo_properties{WO_property(ov::weights_path.name())};
 
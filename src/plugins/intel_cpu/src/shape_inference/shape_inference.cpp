@@ -776,4 +776,8 @@ std::shared_ptr<IStaticShapeInfer> make_shape_inference(std::shared_ptr<ov::Node
     return std::make_shared<ShapeInferFallback>(std::move(op));
 }
 
+bool has_padding(const IStaticShapeInfer& shape_infer) {
+    return dynamic_cast<const ShapeInferPaddingBase*>(&shape_infer) != nullptr;
+}
+
 }  // namespace ov::intel_cpu
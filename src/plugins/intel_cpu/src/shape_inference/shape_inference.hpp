@@ -35,4 +35,10 @@ public:
 };
 
 std::shared_ptr<IStaticShapeInfer> make_shape_inference(std::shared_ptr<ov::Node> op);
+
+/**
+ * @brief Checks whether the shape inference object produces padding, i.e. get_pads_begin() and get_pads_end() return
+ * values calculated by the last infer call.
+ */
+bool has_padding(const IStaticShapeInfer& shape_infer);
 }  // namespace ov::intel_cpu
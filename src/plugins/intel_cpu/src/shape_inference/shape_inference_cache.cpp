@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference/shape_inference_cache.hpp"
+
+#include <common/utils.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/primitive_hashing_utils.hpp"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/except.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+
+namespace ov::intel_cpu {
+
+ShapeInferCache::ShapeInferCache(ShapeInferPtr shape_infer, size_t capacity)
+    : m_shape_infer(std::move(shape_infer)),
+      m_cache(capacity) {
+    OPENVINO_ASSERT(m_shape_infer, "ShapeInferCache requires a shape inference object to wrap");
+}
+
+IShapeInfer::Result ShapeInferCache::infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                                           const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    Key key;
+    key.dims.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes) {
+        key.dims.push_back(shape.get());
+    }
+
+    size_t values_size = 0;
+    for (size_t port = 0; port < input_shapes.size(); ++port) {
+        auto itr = data_dependency.find(port);
+        if (itr == data_dependency.end() || !itr->second) {
+            continue;
+        }
+        const auto size = itr->second->getSize();
+        values_size += size;
+        if (values_size > max_values_size) {
+            return m_shape_infer->infer(input_shapes, data_dependency);
+        }
+        // the port number separates the values of the different inputs within the key
+        key.values.push_back(static_cast<uint8_t>(port));
+        const auto* data = static_cast<const uint8_t*>(itr->second->getData());
+        key.values.insert(key.values.end(), data, data + size);
+    }
+
+    if (auto cached = m_cache.get(key)) {
+        return *cached;
+    }
+
+    auto result = m_shape_infer->infer(input_shapes, data_dependency);
+    if (ShapeInferStatus::success == result.status) {
+        m_cache.put(key, std::make_shared<const Result>(result));
+    }
+    return result;
+}
+
+size_t ShapeInferCache::Key::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+    using namespace dnnl::impl;
+    size_t seed = 0;
+    for (const auto& item : dims) {
+        seed = get_vector_hash(seed, item);
+    }
+    seed = get_vector_hash(seed, values);
+    return seed;
+}
+
+bool ShapeInferCache::Key::operator==(const Key& rhs) const {
+    return dims == rhs.dims && values == rhs.values;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "openvino/core/coordinate_diff.hpp"
+#include "shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Shape inference decorator which memoizes the results of the wrapped shape inference object by the input shapes and
+ * the values of the data dependent inputs, so the repeated shapes (e.g. alternating prefill and decode steps) are
+ * resolved by a lookup instead of a new shape inference call.
+ * The number of records is bounded by the LRU capacity. The data dependent inputs bigger than the values limit are not
+ * cached and always go to the wrapped object.
+ *
+ * @note The wrapped shape inference object must not produce padding, as padding is not a part of the cached result.
+ */
+class ShapeInferCache final : public ShapeInferEmptyPads {
+public:
+    static constexpr size_t default_capacity = 16;
+    static constexpr size_t max_values_size = 256;  // in bytes
+
+    explicit ShapeInferCache(ShapeInferPtr shape_infer, size_t capacity = default_capacity);
+
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return m_shape_infer->get_port_mask();
+    }
+
+private:
+    struct Key {
+        std::vector<VectorDims> dims;
+        std::vector<uint8_t> values;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Key& rhs) const;
+    };
+
+    ShapeInferPtr m_shape_infer;
+    LruCache<Key, std::shared_ptr<const Result>> m_cache;
+};
+
+}  // namespace ov::intel_cpu
@@ -10,12 +10,18 @@
 #include "openvino/core/coordinate_diff.hpp"
 #include "openvino/core/node.hpp"
 #include "shape_inference/shape_inference.hpp"
+#include "shape_inference/shape_inference_cache.hpp"
 
 namespace ov::intel_cpu {
 NgraphShapeInferFactory::NgraphShapeInferFactory(std::shared_ptr<ov::Node> op) : m_op(std::move(op)) {}
 
 ShapeInferPtr NgraphShapeInferFactory::makeShapeInfer() const {
-    return make_shape_inference(m_op);
+    auto shape_infer = make_shape_inference(m_op);
+    // the shape only inference is cheaper than the cache lookup, only the data dependent one is memoized
+    if (has_padding(*shape_infer) || shape_infer->get_port_mask() == EMPTY_PORT_MASK) {
+        return shape_infer;
+    }
+    return std::make_shared<ShapeInferCache>(std::move(shape_infer));
 }
 
 const ov::CoordinateDiff ShapeInferEmptyPads::m_emptyVec = {};
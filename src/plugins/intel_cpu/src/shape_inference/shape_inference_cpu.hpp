@@ -96,7 +96,9 @@ public:
 };
 
 /**
- * Shape inference factory creates shape inference objects that use ngraph shape inference implementations.
+ * Shape inference factory creates shape inference objects that use ngraph shape inference implementations. The objects
+ * which depend on the input data and don't produce padding are wrapped with ShapeInferCache to memoize the results
+ * for the repeated input shapes.
  *
  */
 class NgraphShapeInferFactory final : public ShapeInferFactory {
@@ -4,27 +4,34 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cassert>
-#include <mutex>
+#include <cstddef>
 #include <vector>
 
 namespace ov::intel_cpu {
+/**
+ * @brief Exchange table of the tensor parallel sub-streams. The sub-streams publish their buffers and synchronize on
+ * the atomics only, so no lock is taken on the per-layer path. Two tables are used in turns, hence a sub-stream may
+ * start the next layer while the slower ones are still reading the buffers of the previous one.
+ */
 class SubMemoryManager {
 public:
     struct MemoryInfo {
+        // written by the owner sub-stream before the flag is released
         void* send_buf = nullptr;
-        bool flag = false;
+        std::atomic<bool> flag{false};
         bool last_used = false;
     };
 
-    explicit SubMemoryManager(int num_sub_streams) {
+    explicit SubMemoryManager(int num_sub_streams) : _num_sub_streams(num_sub_streams) {
         assert(num_sub_streams);
-        _num_sub_streams = num_sub_streams;
-        MemoryInfo memory_info;
-        std::vector<MemoryInfo> memorys;
-        memorys.assign(_num_sub_streams, memory_info);
-        _memorys_table.assign(2, memorys);
-        _use_count.assign(2, 0);
+        _memorys_table.reserve(_use_count.size());
+        for (size_t i = 0; i < _use_count.size(); i++) {
+            _memorys_table.emplace_back(_num_sub_streams);
+            _use_count[i].store(0);
+        }
     }
 
     int get_memory_id(int sub_stream_id) {
@@ -43,7 +50,7 @@ public:
 
     int _num_sub_streams;
     std::vector<std::vector<MemoryInfo>> _memorys_table;
-    std::vector<int> _use_count;
-    std::mutex _flagMutex;
+    // number of sub-streams done with a table, -1 while the table is being reset
+    std::array<std::atomic<int>, 2> _use_count{};
 };
 }  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #include "brgemm_cpu_blocking.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iterator>
@@ -115,13 +116,25 @@ std::tuple<size_t, size_t, size_t> BrgemmCPUBlocking::get_blocking_params(
 
     const auto [m, n, k] = get_brgemm_dimensions(brgemm_expr);
 
-    const auto default_m_blk = 32;
-    const auto default_n_blk = 64;
-    const auto default_k_blk = !ov::snippets::utils::is_dynamic_value(k) && k > 1024 ? 1024 : 512;
+    const size_t default_m_blk = 32;
+    const size_t default_n_blk = brgemm_config.are_wei_blocked() ? brgemm_config.wei_n_blk() : 64;
+    size_t default_k_blk = !ov::snippets::utils::is_dynamic_value(k) && k > 1024 ? 1024 : 512;
+    if (is_kn_blocking_supported(brgemm->get_input_element_type(1))) {
+        // The A, B and C blocks of one brgemm call should fit into L2, otherwise the B block is evicted between the
+        // iterations over M. It only limits K block on the cores with small L2: the 1024 f32 K block needs
+        // 32 * 64 * 4 + 1024 * (32 + 64) * 4 = 401408 bytes (392KiB).
+        const size_t l2_budget = m_l2_cache_size;
+        const size_t c_blk_size = default_m_blk * default_n_blk * sizeof(float);
+        const size_t elem_size = brgemm->get_input_element_type(1).size();
+        if (l2_budget > c_blk_size) {
+            const size_t max_k_blk = (l2_budget - c_blk_size) / ((default_m_blk + default_n_blk) * elem_size);
+            constexpr size_t min_k_blk = 64;
+            default_k_blk = std::min(default_k_blk, std::max(max_k_blk / min_k_blk * min_k_blk, min_k_blk));
+        }
+    }
 
     size_t m_blk = get_corrected_blk_size_by_dim(m, default_m_blk);
-    size_t n_blk =
-        get_corrected_blk_size_by_dim(n, brgemm_config.are_wei_blocked() ? brgemm_config.wei_n_blk() : default_n_blk);
+    size_t n_blk = get_corrected_blk_size_by_dim(n, default_n_blk);
     size_t k_blk = get_corrected_blk_size_by_dim(k, default_k_blk);
 
     // [TODO]: K,N blocking is functionally enabled, need to turn it on after blocking heuristic is updated to cover
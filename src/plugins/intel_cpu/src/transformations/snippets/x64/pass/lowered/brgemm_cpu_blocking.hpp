@@ -27,6 +27,11 @@ class BrgemmCPUBlocking : public ov::snippets::lowered::pass::BrgemmBlocking<Brg
 public:
     OPENVINO_RTTI("BrgemmCPUBlocking", "", BrgemmBlocking)
 
+    /**
+     * @param l2_cache_size per-core L2 cache size in bytes, the K block of f32 Brgemm is limited to fit into it
+     */
+    explicit BrgemmCPUBlocking(size_t l2_cache_size) : m_l2_cache_size(l2_cache_size) {}
+
     /**
      * @interface DummyPass
      * @brief The empty pass which is used to force insertion of first specific iteration of loop by K dimension
@@ -85,6 +90,8 @@ private:
                              size_t m_block,
                              size_t n_block,
                              size_t k_block) override;
+
+    size_t m_l2_cache_size;
 };
 
 }  // namespace ov::intel_cpu::pass
@@ -68,6 +68,7 @@
 #include "transformations/common_optimizations/mark_precision_sensitive_shapeof_subgraphs.hpp"
 #include "transformations/common_optimizations/mark_rope_input_to_keep_in_mixed_precision.hpp"
 #include "transformations/common_optimizations/matmul_const_transposes_extraction.hpp"
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
 #include "transformations/common_optimizations/move_eltwise_up_data_movement.hpp"
 #include "transformations/common_optimizations/mul_fake_quantize_fusion.hpp"
 #include "transformations/common_optimizations/nop_elimination.hpp"
@@ -175,8 +176,11 @@
 
 #if defined(OPENVINO_ARCH_ARM64)
 #    include "cpu/aarch64/cpu_isa_traits.hpp"
+#    include "nodes/rms_norm.h"
 #    include "openvino/op/add.hpp"
 #    include "openvino/op/swish.hpp"
+#    include "transformations/common_optimizations/rms_fusion.hpp"
+#    include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
 #    include "transformations/snippets/aarch64/pass/snippets_mark_skipped.hpp"
 #else
 #    include "openvino/op/convolution.hpp"
@@ -1179,15 +1183,20 @@ void Transformations::PostLpt() {
     }
 #endif  // OPENVINO_ARCH_X86_64
 
-    CPU_REGISTER_PASS_X64(postLPTPassManager, ov::pass::RMSFusion, false);
-    CPU_REGISTER_PASS_X64(postLPTPassManager, ov::intel_cpu::DecomposeRMSNorm);
-    CPU_SET_CALLBACK_X64(
+    // runs after the QKV & MLP fusions, which need the projections as separate MatMuls
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MatMulHorizontalFusion);
+
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::RMSFusion, false);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::intel_cpu::DecomposeRMSNorm);
+    CPU_SET_CALLBACK_COMMON(
         postLPTPassManager,
         [](const std::shared_ptr<const ov::Node>& node) -> bool {
             std::string errorMsg;
             return node::RMSNorm::isSupportedOperation(node, errorMsg);
         },
         ov::intel_cpu::DecomposeRMSNorm);
+#endif
 
     // markup Rope Input when BF16/F16 inference.
     if (any_of(config.inferencePrecision, ov::element::bf16, ov::element::f16)) {
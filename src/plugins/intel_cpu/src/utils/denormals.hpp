@@ -14,12 +14,12 @@ namespace ov::intel_cpu {
 static constexpr unsigned int FTZ_FLAG = 0x8000;
 static constexpr unsigned int DAZ_FLAG = 0x0040;
 
-bool flush_to_zero(bool on);
-bool denormals_as_zero(bool on);
+inline bool flush_to_zero(bool on);
+inline bool denormals_as_zero(bool on);
 
 #ifdef OPENVINO_ARCH_X86_64
 
-bool flush_to_zero(bool on) {
+inline bool flush_to_zero(bool on) {
     unsigned int mxcsr = _mm_getcsr();
     if (on) {
         mxcsr |= FTZ_FLAG;
@@ -30,7 +30,7 @@ bool flush_to_zero(bool on) {
     return true;
 }
 
-bool denormals_as_zero(bool on) {
+inline bool denormals_as_zero(bool on) {
     unsigned int mxcsr = _mm_getcsr();
     if (on) {
         mxcsr |= DAZ_FLAG;
@@ -42,7 +42,7 @@ bool denormals_as_zero(bool on) {
 }
 #else  // OPENVINO_ARCH_X86_64
 #    if defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
-bool flush_to_zero(bool on) {
+inline bool flush_to_zero(bool on) {
     unsigned int mxcsr = _mm_getcsr();
     if (on) {
         mxcsr |= FTZ_FLAG;
@@ -53,7 +53,7 @@ bool flush_to_zero(bool on) {
     return true;
 }
 
-bool denormals_as_zero(bool on) {
+inline bool denormals_as_zero(bool on) {
     // for some processor, DAZ flag is a reserved bit even SSE is available. Set 1 to this flag will generate #GP
     // exception.
     struct {
@@ -112,13 +112,55 @@ bool denormals_as_zero(bool on) {
     }
 }
 #    else
-bool flush_to_zero(bool on) {
+inline bool flush_to_zero(bool on) {
     return false;
 }
-bool denormals_as_zero(bool on) {
+inline bool denormals_as_zero(bool on) {
     return false;
 }
 #    endif
 #endif  // OPENVINO_ARCH_X86_64
 
+/**
+ * @brief Sets FTZ and DAZ of the calling thread for the lifetime of the object and restores the previous MXCSR state
+ * on destruction, so the denormals mode of one compiled model does not leak to the other models executed by the same
+ * thread. Only the calling thread is affected, the worker threads of the parallel runtime are not.
+ */
+class DenormalsScope {
+public:
+    explicit DenormalsScope(bool on) {
+#if defined(OPENVINO_ARCH_X86_64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        m_mxcsr = _mm_getcsr();
+        m_restore = true;
+#endif
+        flush_to_zero(on);
+        m_daz = denormals_as_zero(on);
+    }
+
+    ~DenormalsScope() {
+#if defined(OPENVINO_ARCH_X86_64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        if (m_restore) {
+            _mm_setcsr(m_mxcsr);
+        }
+#endif
+    }
+
+    DenormalsScope(const DenormalsScope&) = delete;
+    DenormalsScope& operator=(const DenormalsScope&) = delete;
+
+    /**
+     * @brief Whether the DAZ flag was actually applied, it may be reserved on some processors
+     */
+    [[nodiscard]] bool daz() const {
+        return m_daz;
+    }
+
+private:
+#if defined(OPENVINO_ARCH_X86_64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    unsigned int m_mxcsr = 0;
+    bool m_restore = false;
+#endif
+    bool m_daz = false;
+};
+
 }  // namespace ov::intel_cpu
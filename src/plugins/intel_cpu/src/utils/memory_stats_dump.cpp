@@ -53,6 +53,10 @@ static void dumpStatistics(std::ostream& os,
         os << "Socket ID: " << item.first << "\n";
         os << "Total size: " << item.second.total_size << " bytes\n";
         os << "Total memory objects: " << item.second.total_memory_objects << "\n";
+        if (item.second.numa_node >= 0) {
+            os << "NUMA node: " << item.second.numa_node << "\n";
+            os << "Bound to NUMA node size: " << item.second.bound_size << " bytes\n";
+        }
     }
 }
 
@@ -90,11 +94,12 @@ static void dumpStatisticsCSV(std::ofstream& os,
     if (!weights_statistics.empty()) {
         os << ";;;;;;\n";
         os << "Weights cache statistics;;;;;;\n";
-        os << "Socket ID;Total size [bytes];Total memory objects [-];;;\n";
+        os << "Socket ID;Total size [bytes];Total memory objects [-];NUMA node [-];Bound size [bytes];;\n";
     }
 
     for (auto&& item : weights_statistics) {
-        os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";;;;;\n";
+        os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";"
+           << item.second.numa_node << ";" << item.second.bound_size << ";;;\n";
     }
 }
 
@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/warmup_shapes.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+// unlike std::getline based splitting, keeps the trailing empty item, which stands for a scalar shape
+std::vector<std::string> split(const std::string& str, char delim) {
+    std::vector<std::string> result;
+    size_t begin = 0;
+    for (size_t end = str.find(delim); end != std::string::npos; end = str.find(delim, begin)) {
+        result.push_back(str.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    result.push_back(str.substr(begin));
+    return result;
+}
+
+}  // namespace
+
+bool WarmupShapes::record(const InputShapes& shapes) {
+    if (full()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool inserted = false;
+    if (m_shapes.size() < m_capacity) {
+        inserted = m_shapes.insert(shapes).second;
+    }
+    if (m_shapes.size() >= m_capacity) {
+        m_full.store(true, std::memory_order_relaxed);
+    }
+    return inserted;
+}
+
+std::vector<WarmupShapes::InputShapes> WarmupShapes::get() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_shapes.begin(), m_shapes.end()};
+}
+
+bool WarmupShapes::empty() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_shapes.empty();
+}
+
+std::string WarmupShapes::serialize() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::stringstream ss;
+    bool firstCombination = true;
+    for (const auto& shapes : m_shapes) {
+        if (!firstCombination) {
+            ss << '|';
+        }
+        firstCombination = false;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            if (i != 0) {
+                ss << ';';
+            }
+            for (size_t j = 0; j < shapes[i].size(); ++j) {
+                if (j != 0) {
+                    ss << ',';
+                }
+                ss << shapes[i][j];
+            }
+        }
+    }
+    return ss.str();
+}
+
+std::vector<WarmupShapes::InputShapes> WarmupShapes::deserialize(const std::string& str) {
+    std::vector<InputShapes> result;
+    if (str.empty()) {
+        return result;
+    }
+    for (const auto& combination : split(str, '|')) {
+        InputShapes shapes;
+        for (const auto& shapeStr : split(combination, ';')) {
+            ov::Shape shape;
+            if (shapeStr.empty()) {
+                shapes.push_back(shape);
+                continue;
+            }
+            for (const auto& dim : split(shapeStr, ',')) {
+                try {
+                    shape.push_back(static_cast<size_t>(std::stoull(dim)));
+                } catch (const std::exception&) {
+                    OPENVINO_THROW("Invalid dimension '", dim, "' in the CPU warm-up shapes: ", str);
+                }
+            }
+            shapes.push_back(shape);
+        }
+        result.push_back(shapes);
+    }
+    return result;
+}
+
+void WarmupShapes::store(const std::filesystem::path& path) const {
+    std::lock_guard<std::mutex> lock(m_storeMutex);
+    const auto str = serialize();
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    ov::util::save_binary(tmp_path, str.data(), str.size());
+    std::filesystem::rename(tmp_path, path);
+}
+
+std::vector<WarmupShapes::InputShapes> WarmupShapes::load(const std::filesystem::path& path) {
+    if (!ov::util::file_exists(path)) {
+        return {};
+    }
+    const auto data = ov::util::load_binary(path);
+    return deserialize(std::string(data.begin(), data.end()));
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Bounded set of distinct input shape combinations observed by the dynamic graphs of a compiled model.
+ * The set is stored in the rt_info of the exported model, so the imported model may replay the shapes to create the
+ * runtime primitives and JIT kernels before the first inference instead of during it.
+ */
+class WarmupShapes {
+public:
+    using InputShapes = std::vector<ov::Shape>;
+
+    static constexpr const char* rt_info_key = "cpu_warmup_shapes";
+    // identifies the file, which keeps the shapes recorded after the model had been exported to the cache directory
+    static constexpr const char* file_id_rt_info_key = "cpu_warmup_shapes_file";
+    static constexpr const char* file_extension = ".cpu_warmup";
+
+    explicit WarmupShapes(size_t capacity = 64) : m_capacity(capacity) {}
+
+    /**
+     * @brief Thread safe. Adds the shapes combination if it has not been seen yet and the capacity is not exhausted.
+     * @return true if the combination has been added
+     */
+    bool record(const InputShapes& shapes);
+
+    /**
+     * @brief Lock free check whether the capacity is exhausted, so the callers may skip collecting the shapes.
+     */
+    [[nodiscard]] bool full() const {
+        return m_full.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::vector<InputShapes> get() const;
+
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Text form: input shapes are delimited by ';', the combinations - by '|', e.g. "1,3,16;1|1,3,32;1"
+     */
+    [[nodiscard]] std::string serialize() const;
+
+    static std::vector<InputShapes> deserialize(const std::string& str);
+
+    /**
+     * @brief Thread safe. Replaces the file content with the text form, the file is written aside and renamed, so
+     * a concurrent reader never sees it partially written.
+     */
+    void store(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Reads the combinations stored by store(), a missing file gives no combinations.
+     */
+    static std::vector<InputShapes> load(const std::filesystem::path& path);
+
+private:
+    size_t m_capacity;
+    mutable std::mutex m_mutex;
+    mutable std::mutex m_storeMutex;
+    std::set<InputShapes> m_shapes;
+    std::atomic_bool m_full{false};
+};
+
+}  // namespace ov::intel_cpu
@@ -62,7 +62,11 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 
         if (!isCached()) {
             newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+            bool boundToNode = false;
+            if (m_numaNodeId >= 0 && newPtr && newPtr->getSize() > 0) {
+                boundToNode = mbind_move(newPtr, m_numaNodeId);
+            }
+            ptr = std::make_shared<MemoryInfo>(newPtr, valid, boundToNode);
             sharedWeights[key] = ptr;
         }
     }
@@ -93,10 +97,25 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+// returns the first NUMA node of the socket, or -1 if it cannot be determined
+static int get_socket_numa_node(int socket_id) {
+    const auto proc_type_table = get_proc_type_table();
+    // the first row is a summary if there are more than one NUMA node
+    const size_t first_row = proc_type_table.size() > 1 ? 1 : 0;
+    for (size_t i = first_row; i < proc_type_table.size(); i++) {
+        if (proc_type_table[i][PROC_SOCKET_ID] == socket_id) {
+            return proc_type_table[i][PROC_NUMA_NODE_ID];
+        }
+    }
+    return -1;
+}
+
+SocketsWeights::SocketsWeights(bool numaPlacement) {
     int num_sockets = get_num_sockets();
+    // binding makes sense only if the weights may be placed on a remote node
+    const bool bindToNode = numaPlacement && get_num_numa_nodes() > 1;
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] = std::make_shared<WeightsSharing>(bindToNode ? get_socket_numa_node(socket_id) : -1);
     }
 }
 
@@ -114,15 +133,19 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
 
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
-    Statistics retVal = {0, 0};
+    Statistics retVal = {0, 0, m_numaNodeId, 0};
 
     std::lock_guard<std::mutex> lock(guard);
 
     for (const auto& item : sharedWeights) {
         auto memory = item.second->sharedMemory.lock();
         if (memory) {
-            retVal.total_size += memory->getDesc().getCurrentMemSize();
+            const auto size = memory->getDesc().getCurrentMemSize();
+            retVal.total_size += size;
             retVal.total_memory_objects++;
+            if (item.second->boundToNode) {
+                retVal.bound_size += size;
+            }
         }
     }
 
@@ -34,11 +34,15 @@ class WeightsSharing {
     struct MemoryInfo {
         using Ptr = std::shared_ptr<MemoryInfo>;
 
-        MemoryInfo(const MemoryPtr& memoryPtr, bool valid) : sharedMemory(memoryPtr), valid(valid) {}
+        MemoryInfo(const MemoryPtr& memoryPtr, bool valid, bool boundToNode = false)
+            : sharedMemory(memoryPtr),
+              valid(valid),
+              boundToNode(boundToNode) {}
 
         std::mutex guard;
         std::weak_ptr<IMemory> sharedMemory;
         std::atomic<bool> valid;
+        bool boundToNode;
     };
 
 public:
@@ -46,11 +50,19 @@ public:
     struct Statistics {
         size_t total_size;  // bytes
         size_t total_memory_objects;
+        int numa_node;     // -1 if the placement is not enforced
+        size_t bound_size;  // bytes bound to numa_node
     };
 #endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    /**
+     * @param numaNodeId if non negative, the newly created memory objects are bound to the specified NUMA node, so the
+     * weights are local to the streams running on it regardless of the thread which has created them
+     */
+    explicit WeightsSharing(int numaNodeId = -1) : m_numaNodeId(numaNodeId) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -80,6 +92,7 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    int m_numaNodeId;
 };
 
 /**
@@ -89,7 +102,10 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    /**
+     * @param numaPlacement defines whether the weights of each socket are bound to the memory of its NUMA node
+     */
+    explicit SocketsWeights(bool numaPlacement = false);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+std::shared_ptr<ov::Model> make_dynamic_matmul_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto weights = ov::test::utils::make_constant(ov::element::f32, ov::Shape{16, 8});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+    return std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{param}, "WarmupShapesCache");
+}
+
+// The blob is written to the cache directory right after the compilation, so the shapes executed afterwards reach
+// the model loaded from the cache through the file stored next to the blob.
+TEST(WarmupShapesCacheTest, RecordedShapesWarmUpModelLoadedFromCache) {
+    const std::string cache_dir = ov::test::utils::generateTestFilePrefix() + "_warmup_shapes_cache";
+    const auto model = make_dynamic_matmul_model();
+    ov::Core core;
+    core.set_property(ov::cache_dir(cache_dir));
+    {
+        auto compiled_model = core.compile_model(model, "CPU");
+        ASSERT_FALSE(compiled_model.get_property(ov::loaded_from_cache));
+        auto request = compiled_model.create_infer_request();
+        ov::Tensor input(ov::element::f32, {3, 16});
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        request.set_input_tensor(input);
+        request.infer();
+    }
+    ASSERT_EQ(ov::test::utils::listFilesWithExt(cache_dir, "cpu_warmup").size(), 1);
+    {
+        auto compiled_model = core.compile_model(model, "CPU");
+        ASSERT_TRUE(compiled_model.get_property(ov::loaded_from_cache));
+        // the first infer request schedules the warm-up, the export waits for the replayed shapes to be recorded
+        compiled_model.create_infer_request();
+        std::stringstream blob;
+        compiled_model.export_model(blob);
+        EXPECT_NE(blob.str().find("<cpu_warmup_shapes value=\"3,16\""), std::string::npos);
+    }
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeFilesWithExt(cache_dir, "cpu_warmup");
+    ov::test::utils::removeDir(cache_dir);
+}
+
+}  // namespace
@@ -195,6 +195,43 @@ INSTANTIATE_TEST_SUITE_P(InterpolateLinear_Layout_Test_scales, InterpolateLayerC
             ::testing::ValuesIn(filterAdditionalConfig)),
     InterpolateLayerCPUTest::getTestCaseName);
 
+// cubic mode is executed by the reference implementation, the upscaling by height uses its separable two-pass form
+const std::vector<ShapeParams> shapeParams4D_CubicUpscale = {
+    ShapeParams{
+        ov::op::v11::Interpolate::ShapeCalcMode::SIZES,
+        InputShape{{}, {{1, 3, 4, 5}}},
+        ov::test::utils::InputLayerType::CONSTANT,
+        {{1, 3, 10, 7}},
+        defaultAxes4D.front()
+    },
+    ShapeParams{
+        ov::op::v11::Interpolate::ShapeCalcMode::SCALES,
+        InputShape{{-1, {2, 20}, -1, -1}, {{1, 11, 4, 4}, {2, 7, 6, 5}, {1, 11, 4, 4}}},
+        ov::test::utils::InputLayerType::CONSTANT,
+        {{1.f, 1.f, 2.5f, 0.75f}},
+        defaultAxes4D.front()
+    }
+};
+
+const auto interpolateCasesCubicUpscale = ::testing::Combine(
+        ::testing::Values(ov::op::v11::Interpolate::InterpolateMode::CUBIC),
+        ::testing::ValuesIn(coordinateTransformModes_Full),
+        ::testing::ValuesIn(defNearestModes()),
+        ::testing::ValuesIn(antialias()),
+        ::testing::ValuesIn(pads4D),
+        ::testing::ValuesIn(pads4D),
+        ::testing::ValuesIn(cubeCoefs()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterpolateCubicUpscale_Layout_Test, InterpolateLayerCPUTest,
+        ::testing::Combine(
+            interpolateCasesCubicUpscale,
+            ::testing::ValuesIn(shapeParams4D_CubicUpscale),
+            ::testing::Values(ElementType::f32),
+            ::testing::Values(CPUSpecificParams{{nchw, x, x, x}, {nchw}, {"ref"}, "ref"}),
+            ::testing::ValuesIn(interpolateFusingParamsSet),
+            ::testing::Values(ov::AnyMap{ov::hint::inference_precision(ov::element::f32)})),
+    InterpolateLayerCPUTest::getTestCaseName);
+
 // corner cases
 const std::vector<ShapeParams> shapeParams4D_corner = {
     ShapeParams{
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "custom/single_layer_tests/classes/rms_norm.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+namespace RMSNorm {
+const auto cpuSpec = CPUSpecificParams{{}, {}, {"jit_asimd"}, "jit_asimd"};
+
+const std::vector<std::vector<InputShape>> shapes{
+    // normal
+    {
+        // data shape
+        {ov::test::InputShape{ov::PartialShape{-1, -1, 1024 + 16 + 1},
+            {ov::Shape{1, 8, 1024 + 16 + 1}, ov::Shape{2, 3, 1024 + 16 + 1}}}
+        },
+        // scale shape
+        {ov::test::InputShape{ov::PartialShape{1024 + 16 + 1},
+            {ov::Shape{1024 + 16 + 1}, ov::Shape{1024 + 16 + 1}}}
+        },
+    },
+    // small data size
+    {
+        // data shape
+        {ov::test::InputShape{ov::PartialShape{-1, -1, 3},
+            {ov::Shape{1, 8, 3}, ov::Shape{2, 3, 3}}}
+        },
+        // scale shape
+        {ov::test::InputShape{ov::PartialShape{3},
+            {ov::Shape{3}, ov::Shape{3}}}
+        },
+    },
+    // scale is scalar
+    {
+        // data shape
+        {ov::test::InputShape{ov::PartialShape{-1, -1, 1094},
+            {ov::Shape{1, 8, 1094}, ov::Shape{2, 3, 1094}}}
+        },
+        // scale shape
+        {ov::test::InputShape{ov::PartialShape{1},
+            {ov::Shape{1}, ov::Shape{1}}}
+        },
+    },
+};
+
+const auto params = testing::Combine(testing::Values(ElementType::f16),
+                                     testing::ValuesIn(shapes),
+                                     testing::Values(ov::test::utils::DEVICE_CPU),
+                                     testing::Values(cpuSpec));
+
+INSTANTIATE_TEST_SUITE_P(smoke_RMSNorm_CPU,
+                         RMSNormLayerCPUTest,
+                         params,
+                         RMSNormLayerCPUTest::getTestCaseName);
+
+}  // namespace RMSNorm
+}  // namespace test
+}  // namespace ov
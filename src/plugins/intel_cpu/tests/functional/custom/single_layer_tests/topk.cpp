@@ -409,6 +409,26 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+// a vocabulary sized innermost axis with a few rows, the axis is split between the threads
+std::vector<ov::test::InputShape> inputShapes_large_axis = {
+    {{}, {{1, 1, 2, 65536}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_TopK_large_axis,
+    TopKLayerCPUTest,
+    ::testing::Combine(::testing::Combine(::testing::Values(1, 18),
+                                          ::testing::Values(3),
+                                          ::testing::ValuesIn(modes),
+                                          ::testing::ValuesIn(sortTypeStable),
+                                          ::testing::ValuesIn(netPrecisions),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::Values(ElementType::dynamic),
+                                          ::testing::ValuesIn(inputShapes_large_axis)),
+                       ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+                       ::testing::ValuesIn(additionalConfig)),
+    TopKLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(
     smoke_TopK_negative,
     TopKLayerInvalidK,
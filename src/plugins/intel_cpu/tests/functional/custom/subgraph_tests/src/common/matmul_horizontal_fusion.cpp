@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/relu.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/* MatMuls sharing the input and having constant weights are executed by a single FullyConnected.
+
+              Parameter
+            /     |     \
+    MatMul(W0) MatMul(W1) MatMul(W2)
+        |         |         |
+      Relu      Relu      Relu
+*/
+class MatMulHorizontalFusionTest : virtual public SubgraphBaseStaticTest, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 16})};
+        ov::ResultVector results;
+        for (const size_t n : {8, 16, 24}) {
+            auto weights = ov::test::utils::make_constant(ov::element::f32, ov::Shape{16, n});
+            auto matmul = std::make_shared<ov::op::v0::MatMul>(params[0], weights);
+            results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v0::Relu>(matmul)));
+        }
+        function = std::make_shared<ov::Model>(results, params, "MatMulHorizontalFusion");
+    }
+};
+
+TEST_F(MatMulHorizontalFusionTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+}
+
+}  // namespace test
+}  // namespace ov
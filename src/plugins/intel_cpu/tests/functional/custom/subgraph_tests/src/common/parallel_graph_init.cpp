@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/* The parallel initialization of the supported primitive descriptors must select the same implementations and
+ * layouts as the sequential one.
+
+    Parameter
+        |
+    Convolution
+        |
+      Relu
+        |
+    Multiply
+        |
+    Reshape
+        |
+     MatMul
+*/
+class ParallelGraphInitTest : virtual public SubgraphBaseStaticTest, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::cpu_parallel_graph_init.name(), true});
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 8, 8, 8})};
+        auto conv = ov::test::utils::make_convolution(params[0],
+                                                      ov::element::f32,
+                                                      {3, 3},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      ov::op::PadType::EXPLICIT,
+                                                      16);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        auto scale = ov::test::utils::make_constant(ov::element::f32, ov::Shape{1, 16, 1, 1});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(relu, scale);
+        auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 16 * 8 * 8});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(multiply, shape, false);
+        auto weights = ov::test::utils::make_constant(ov::element::f32, ov::Shape{16 * 8 * 8, 32});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(reshape, weights);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(matmul)},
+                                               params,
+                                               "ParallelGraphInit");
+    }
+};
+
+TEST_F(ParallelGraphInitTest, CompareWithSequential) {
+    run();
+
+    auto sequentialConfig = configuration;
+    sequentialConfig[ov::intel_cpu::cpu_parallel_graph_init.name()] = false;
+    const auto sequentialModel = core->compile_model(function, targetDevice, sequentialConfig);
+
+    auto execInfo = [](const ov::CompiledModel& model) {
+        std::map<std::string, std::string> result;
+        for (const auto& node : model.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            result[node->get_friendly_name()] = rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() + ":" +
+                                                rtInfo.at(ov::exec_model_info::IMPL_TYPE).as<std::string>() + ":" +
+                                                rtInfo.at(ov::exec_model_info::OUTPUT_LAYOUTS).as<std::string>();
+        }
+        return result;
+    };
+    ASSERT_EQ(execInfo(compiledModel), execInfo(sequentialModel));
+}
+
+}  // namespace test
+}  // namespace ov
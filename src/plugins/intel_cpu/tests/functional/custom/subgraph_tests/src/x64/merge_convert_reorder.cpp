@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "openvino/op/convert.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using MergeConvertReorderParams = std::tuple<ov::element::Type,  // input precision
+                                             bool>;              // whether Convert is expected to be merged
+
+/* The Convert keeps the planar layout of the input, so the Convolution requires a Reorder to the blocked layout.
+ * The exact conversions to f32 are merged with this Reorder into a single one, the others are kept as is.
+
+    Parameter[prc, nchw]
+          |
+    Convert[f32, nchw]
+          |
+    Reorder[f32, nChw8c/nChw16c] (Is inserted by the Graph)
+          |
+    Convolution[f32]
+*/
+class MergeConvertReorderTest : public testing::WithParamInterface<MergeConvertReorderParams>,
+                                virtual public SubgraphBaseStaticTest,
+                                public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MergeConvertReorderParams>& obj) {
+        const auto& [inPrc, merged] = obj.param;
+        std::ostringstream result;
+        result << "InPrc=" << inPrc << "_merged=" << merged;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [inPrc, merged] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        inType = inPrc;
+        outType = ov::element::f32;
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(inPrc, ov::Shape{1, 16, 10, 10})};
+        auto convert = std::make_shared<ov::op::v0::Convert>(params[0], ov::element::f32);
+        auto conv = ov::test::utils::make_convolution(convert,
+                                                      ov::element::f32,
+                                                      {3, 3},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      ov::op::PadType::EXPLICIT,
+                                                      32);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(conv)},
+                                               params,
+                                               "MergeConvertReorder");
+    }
+};
+
+TEST_P(MergeConvertReorderTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP() << "Skipping test, blocked convolution layouts require avx2";
+    }
+    const auto merged = std::get<1>(GetParam());
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Convert", merged ? 0 : 1);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_MergeConvertReorder,
+                         MergeConvertReorderTest,
+                         ::testing::Values(MergeConvertReorderParams{ov::element::u8, true},
+                                           MergeConvertReorderParams{ov::element::i8, true},
+                                           MergeConvertReorderParams{ov::element::i32, false}),
+                         MergeConvertReorderTest::getTestCaseName);
+}  // namespace
+}  // namespace test
+}  // namespace ov
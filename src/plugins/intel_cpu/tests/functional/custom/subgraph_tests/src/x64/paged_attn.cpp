@@ -792,6 +792,29 @@ INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest_WithSlidingWindowAndSinks,
                                             ::testing::Values(false)),  // addSharedReader
                          PagedAttnTestBase::getTestCaseName);
 
+// A few tokens over a long context (e.g. speculative decoding verification) read the kv cache directly and apply
+// the causal mask between the new tokens, the longer queries afterwards go through the kv cache reordering.
+const std::vector<InputShapes> inputShapesSmallQuery = {
+    {
+        // L1, B, H, S
+        {{-1, 1, 8, 64}, {{256, 1, 8, 64}, {8, 1, 8, 64}, {32, 1, 8, 64}, {1, 1, 8, 64}}},
+        // B, L0, H, S
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {256, 1, 8, 64}, {264, 1, 8, 64}, {296, 1, 8, 64}}},
+    }};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest_SmallQuery,
+                         PagedAttnVSSDPATest,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16),
+                                            ::testing::ValuesIn(inputShapesSmallQuery),
+                                            ::testing::Values(false),  // extendBlockIndices
+                                            ::testing::Values(false),  // enableXattn
+                                            ::testing::Values(false),  // sinkInput
+                                            ::testing::Values(0, 8),   // slidingWindow
+                                            ::testing::Values(ov::AnyMap{
+                                                {ov::intel_cpu::enable_sage_attn.name(), false}}),
+                                            ::testing::Values(false)),  // addSharedReader
+                         PagedAttnTestBase::getTestCaseName);
+
 // PA1(write=true) + PA2(write=false) sharing the same KV cache.
 // Verifies that PA2 reads the cache populated by PA1 and produces matching output.
 INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnSharedKVCache,
@@ -2,11 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
 #include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/concurrent_cache_entry.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -380,3 +384,91 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ConcurrentCacheEntryTests, GetOrCreate) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 16;
+
+    auto builder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    // single shard keeps the displacement order deterministic
+    ConcurrentCacheEntry<IntKey, ValueType, 1> entry(capacity);
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    for (int i = 0; i < capacity; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+}
+
+TEST(ConcurrentCacheEntryTests, BuilderException) {
+    using ValueType = std::shared_ptr<int>;
+
+    ConcurrentCacheEntry<IntKey, ValueType> entry(10);
+
+    auto throwingBuilder = [](const IntKey&) -> ValueType {
+        throw std::runtime_error("build failed");
+    };
+    ASSERT_THROW(entry.getOrCreate({1}, throwingBuilder), std::runtime_error);
+
+    // failed build must not leave the key in flight
+    auto result = entry.getOrCreate({1}, [](const IntKey& key) { return std::make_shared<int>(key.data); });
+    ASSERT_EQ(*result.first, 1);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+}
+
+TEST(MultiCacheTests, SharedSingleFlight) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+
+    std::atomic_int numBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        ++numBuilds;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    // every key is built exactly once regardless of the number of concurrent users
+    ASSERT_EQ(numBuilds.load(), capacity);
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference/shape_inference_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu_types.h"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "shape_inference/shape_inference_status.hpp"
+
+using namespace ov::intel_cpu;
+using ShapeInferCacheTests = ::testing::Test;
+
+namespace {
+class CountingShapeInfer final : public ShapeInferEmptyPads {
+public:
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>&) override {
+        ++calls;
+        auto dims = input_shapes.front().get();
+        dims.push_back(calls);
+        return {{dims}, ShapeInferStatus::success};
+    }
+    [[nodiscard]] port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+    size_t calls = 0;
+};
+
+IShapeInfer::Result infer(IShapeInfer& shape_infer, const VectorDims& dims) {
+    return shape_infer.infer({std::cref(dims)}, {});
+}
+}  // namespace
+
+TEST_F(ShapeInferCacheTests, repeatedShapesHitCache) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    ShapeInferCache cache(counting);
+
+    const auto first = infer(cache, {1, 16});
+    infer(cache, {1, 32});
+    const auto repeated = infer(cache, {1, 16});
+
+    ASSERT_EQ(counting->calls, 2);
+    ASSERT_EQ(repeated.dims, first.dims);
+}
+
+TEST_F(ShapeInferCacheTests, capacityIsRespected) {
+    auto counting = std::make_shared<CountingShapeInfer>();
+    ShapeInferCache cache(counting, 2);
+
+    infer(cache, {1});
+    infer(cache, {2});
+    infer(cache, {3});
+    infer(cache, {1});
+
+    ASSERT_EQ(counting->calls, 4);
+}
+
+TEST_F(ShapeInferCacheTests, onlyDataDependentShapeInferIsCached) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape::dynamic(2));
+    auto pattern = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(data);
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(data, pattern, false);
+
+    ASSERT_FALSE(std::dynamic_pointer_cast<ShapeInferCache>(NgraphShapeInferFactory(relu).makeShapeInfer()));
+    ASSERT_TRUE(std::dynamic_pointer_cast<ShapeInferCache>(NgraphShapeInferFactory(reshape).makeShapeInfer()));
+}
@@ -109,8 +109,11 @@ class BrgemmCPUBlockingTest : public BrgemmBlockingTest {
 public:
     BrgemmCPUBlockingTest() = default;
 
+    // the L2 size is pinned, so the expected blocks don't depend on the host
+    static constexpr size_t l2_cache_size = 2 * 1024 * 1024;
+
     void SetUp() override {
-        pipeline.register_pass<ov::intel_cpu::pass::BrgemmCPUBlocking>();
+        pipeline.register_pass<ov::intel_cpu::pass::BrgemmCPUBlocking>(l2_cache_size);
     }
 };
 
@@ -40,6 +40,9 @@ using BrgemmConfig = intel_cpu::brgemm_utils::BrgemmConfig;
 
 class BufferAllocationCPUTest : public BufferAllocationTest {
 protected:
+    // the L2 size is pinned, so the Brgemm blocks, and therefore the buffer sizes, don't depend on the host
+    static constexpr size_t l2_cache_size = 2 * 1024 * 1024;
+
     std::shared_ptr<ov::snippets::IShapeInferSnippetsFactory> GetShapeInferFactory() const override {
         return std::make_shared<ov::snippets::CPUShapeInferSnippetsFactory>();
     }
@@ -51,7 +54,7 @@ protected:
         backend_passes.emplace_back(
             ov::snippets::pass::PassPosition(ov::snippets::pass::PassPosition::Place::After,
                                              ov::snippets::lowered::pass::MarkLoops::get_type_info_static()),
-            std::make_shared<ov::intel_cpu::pass::BrgemmCPUBlocking>());
+            std::make_shared<ov::intel_cpu::pass::BrgemmCPUBlocking>(l2_cache_size));
 
         // Add InsertBrgemmCopyBuffers after SplitLoops
         backend_passes.emplace_back(
@@ -226,6 +226,19 @@ TEST_F(ModelPreferThreadsIntegrationTest, direct_x86_hybrid_fallback_use_all) {
     EXPECT_EQ(config.modelPreferThreadsLatency, 12);
 }
 
+TEST_F(ModelPreferThreadsIntegrationTest, direct_x86_hybrid_auto_partitioner_use_all) {
+    Config config;
+    config.threads = 0;
+    config.tbbPartitioner = TbbPartitioner::AUTO;
+    std::vector<std::vector<int>> proc_type_table = {{8, 4, 4, 0, 0, 0, 0}};
+    ov::MemBandwidthPressure tolerance;
+    configure_x86_hybrid_threads(config, proc_type_table, tolerance, false, false);
+    EXPECT_EQ(config.modelPreferThreadsLatency, 8);
+
+    configure_x86_hybrid_threads(config, proc_type_table, tolerance, false, true);
+    EXPECT_EQ(config.modelPreferThreadsLatency, 4);
+}
+
 TEST_F(ModelPreferThreadsIntegrationTest, direct_x86_throughput_ht_adjustment) {
     Config config;
     std::vector<std::vector<int>> proc_type_table = {{16, 8, 0, 0, 8, 0, 0}};
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/warmup_shapes.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/core/except.hpp"
+
+using namespace ov::intel_cpu;
+using WarmupShapesTests = ::testing::Test;
+
+TEST_F(WarmupShapesTests, serializationRoundTrip) {
+    WarmupShapes shapes;
+    shapes.record({{1, 3, 16, 16}, {1}});
+    shapes.record({{2, 3, 32, 32}, {}});
+    shapes.record({{1, 3, 16, 16}, {1}});
+
+    const auto restored = WarmupShapes::deserialize(shapes.serialize());
+    ASSERT_EQ(restored, shapes.get());
+    ASSERT_EQ(restored.size(), 2);
+}
+
+TEST_F(WarmupShapesTests, capacityIsRespected) {
+    WarmupShapes shapes(2);
+    for (size_t i = 1; i < 5; i++) {
+        shapes.record({{i, 8}});
+    }
+    ASSERT_EQ(shapes.get().size(), 2);
+    ASSERT_TRUE(shapes.full());
+}
+
+TEST_F(WarmupShapesTests, notFullBelowCapacity) {
+    WarmupShapes shapes(2);
+    ASSERT_TRUE(shapes.record({{1, 8}}));
+    ASSERT_FALSE(shapes.record({{1, 8}}));
+    ASSERT_FALSE(shapes.full());
+}
+
+TEST_F(WarmupShapesTests, emptyString) {
+    WarmupShapes shapes;
+    ASSERT_TRUE(shapes.empty());
+    ASSERT_TRUE(WarmupShapes::deserialize(shapes.serialize()).empty());
+}
+
+TEST_F(WarmupShapesTests, invalidDimensionThrows) {
+    ASSERT_THROW(WarmupShapes::deserialize("1,x,3"), ov::Exception);
+}
+
+TEST_F(WarmupShapesTests, fileRoundTrip) {
+    const std::filesystem::path path = ov::test::utils::generateTestFilePrefix() + WarmupShapes::file_extension;
+    ASSERT_TRUE(WarmupShapes::load(path).empty());
+
+    WarmupShapes shapes;
+    shapes.record({{1, 3, 16, 16}, {1}});
+    shapes.store(path);
+    shapes.record({{2, 3, 32, 32}, {}});
+    shapes.store(path);
+
+    const auto restored = WarmupShapes::load(path);
+    std::filesystem::remove(path);
+    ASSERT_EQ(restored, shapes.get());
+}
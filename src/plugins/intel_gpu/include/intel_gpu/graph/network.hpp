@@ -215,6 +215,12 @@ public:
         return *_memory_pool;
     }
 
+    /// @brief Returns the memory used by the network in bytes, split by category and allocation type
+    /// ("constant:usm_device", "variable:usm_host", "memory_pool:usm_device", ...) and by primitive
+    /// ("primitive:<id>:usm_device") for the primitives which own their output memory.
+    /// @note Not synchronized with the execution, the caller must prevent the concurrent inferences of the network.
+    std::map<std::string, uint64_t> get_memory_breakdown() const;
+
     void set_variable(const std::string& name, const std::shared_ptr<ov::intel_gpu::VariableStateBase>& variable);
     bool has_variable(const std::string &variable_id) const;
     ov::intel_gpu::VariableStateBase& get_variable(const std::string &variable_id) const;
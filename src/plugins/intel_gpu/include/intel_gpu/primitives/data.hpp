@@ -4,6 +4,7 @@
 
 #pragma once
 #include <algorithm>
+#include <array>
 #include <climits>
 #include <variant>
 #include "intel_gpu/graph/network.hpp"
@@ -33,12 +34,43 @@ bool is_alloc_host_accessible(const cldnn::allocation_type& alloc_type) {
     return alloc_type == cldnn::allocation_type::usm_host || alloc_type == cldnn::allocation_type::usm_shared;
 }
 
+// Uploads the data through two pinned usm_host staging buffers, so the driver can DMA directly from one of them
+// while the CPU fills the other one, instead of bouncing the pageable (e.g. mmap'ed) source pages internally.
+void copy_to_device_mem_staged(cldnn::memory::ptr mem_ptr, const uint8_t* data_ptr, size_t data_size, size_t block_size) {
+    auto& eng = *mem_ptr->get_engine();
+    auto& strm = eng.get_service_stream();
+    const cldnn::layout staging_layout{{static_cast<int64_t>(block_size)}, cldnn::data_types::u8, cldnn::format::bfyx};
+    std::array<cldnn::memory::ptr, 2> staging_bufs = {eng.allocate_memory(staging_layout, cldnn::allocation_type::usm_host, false),
+                                                      eng.allocate_memory(staging_layout, cldnn::allocation_type::usm_host, false)};
+    std::array<cldnn::event::ptr, 2> events = {nullptr, nullptr};
+    size_t buf_idx = 0;
+    for (size_t offset = 0; offset < data_size; offset += block_size) {
+        const size_t copy_size = std::min(block_size, data_size - offset);
+        // Make sure the previous copy from this staging buffer is finished before overwriting it
+        if (events[buf_idx] != nullptr) {
+            events[buf_idx]->wait();
+            events[buf_idx] = nullptr;
+        }
+        std::memcpy(staging_bufs[buf_idx]->buffer_ptr(), data_ptr + offset, copy_size);
+        events[buf_idx] = mem_ptr->copy_from(strm, *staging_bufs[buf_idx], 0, offset, copy_size, false);
+        buf_idx = 1 - buf_idx;
+    }
+    for (auto& ev : events) {
+        if (ev != nullptr)
+            ev->wait();
+    }
+}
+
 void copy_to_dst_mem(cldnn::memory::ptr mem_ptr, const uint8_t* data_ptr) {
+    const size_t DATA_BLOCK_SIZE = 4 * 1024 * 1024;
+    size_t data_size = mem_ptr->size();
     if (is_alloc_host_accessible(mem_ptr->get_allocation_type())) {
-        size_t data_size = mem_ptr->size();
         std::memcpy(reinterpret_cast<uint8_t*>(mem_ptr->buffer_ptr()),
                     data_ptr,
                     data_size);
+    } else if (data_size >= DATA_BLOCK_SIZE && !mem_ptr->get_layout().format.is_image_2d() &&
+               mem_ptr->get_engine()->supports_allocation(cldnn::allocation_type::usm_host)) {
+        copy_to_device_mem_staged(mem_ptr, data_ptr, data_size, DATA_BLOCK_SIZE);
     } else {
         auto& strm = mem_ptr->get_engine()->get_service_stream();
         mem_ptr->copy_from(strm, data_ptr);
@@ -21,7 +21,8 @@ public:
     virtual void cancel() = 0;
     virtual void wait_all() = 0;
 
-    static std::shared_ptr<ICompilationContext> create(ov::threading::IStreamsExecutor::Config task_executor_config);
+    static std::shared_ptr<ICompilationContext> create(ov::threading::IStreamsExecutor::Config task_executor_config,
+                                                       size_t max_pending_tasks = 0);
 };
 
 }  // namespace cldnn
@@ -185,12 +185,23 @@ static constexpr Property<std::vector<std::string>, ov::PropertyMutability::RW>
 static constexpr Property<bool, ov::PropertyMutability::RW> could_use_flashattn_v2{"GPU_COULD_USE_FLASHATTN_V2"};
 static constexpr Property<bool, ov::PropertyMutability::RW> validate_output_buffer{"GPU_VALIDATE_OUTPUT_BUFFER"};
 static constexpr Property<float, ov::PropertyMutability::RW> mem_pool_util_threshold{"GPU_MEM_POOL_UTIL_THRESHOLD"};
+static constexpr Property<float, ov::PropertyMutability::RW> shape_predictor_histogram_percentile{"GPU_SHAPE_PREDICTOR_HISTOGRAM_PERCENTILE"};
+static constexpr Property<size_t, ov::PropertyMutability::RW> shape_predictor_histogram_window{"GPU_SHAPE_PREDICTOR_HISTOGRAM_WINDOW"};
+static constexpr Property<size_t, ov::PropertyMutability::RW> shape_predictor_shrink_idle_iterations{"GPU_SHAPE_PREDICTOR_SHRINK_IDLE_ITERATIONS"};
+static constexpr Property<bool, ov::PropertyMutability::RW> mem_pool_size_classes{"GPU_MEM_POOL_SIZE_CLASSES"};
 static constexpr Property<bool, ov::PropertyMutability::RW> dump_src_after_exec{"GPU_DUMP_SRC_TENSORS_AFTER_EXEC"};
 static constexpr Property<bool, ov::PropertyMutability::RW> allow_bypass_xattn{"GPU_ALLOW_BYPASS_XATTN_EXEC"};
 static constexpr Property<bool, ov::PropertyMutability::RW> network_marker{"GPU_NETWORK_MARKER"};
 static constexpr Property<bool, ov::PropertyMutability::RW> list_layers{"GPU_LIST_LAYERS"};
 static constexpr Property<bool, ov::PropertyMutability::RW> print_input_data_shapes{"GPU_PRINT_INPUT_DATA_SHAPES"};
 static constexpr Property<std::string, ov::PropertyMutability::RW> pa_mixed_route_mode{"GPU_PA_MIXED_ROUTE_MODE"};
+static constexpr Property<std::string, ov::PropertyMutability::RW> kernels_cache_dir{"GPU_KERNELS_CACHE_DIR"};
+static constexpr Property<bool, ov::PropertyMutability::RW> weights_host_fallback{"GPU_WEIGHTS_HOST_FALLBACK"};
+static constexpr Property<size_t, ov::PropertyMutability::RW> async_compilation_threads{"GPU_ASYNC_COMPILATION_THREADS"};
+static constexpr Property<size_t, ov::PropertyMutability::RW> async_compilation_max_pending_tasks{"GPU_ASYNC_COMPILATION_MAX_PENDING_TASKS"};
+static constexpr Property<size_t, ov::PropertyMutability::RW> kv_cache_uncompressed_layers{"GPU_KV_CACHE_UNCOMPRESSED_LAYERS"};
+/// Bytes used by the compiled model per category; "engine_current:*" and "engine_peak:*" are engine wide and include the other models
+static constexpr Property<std::map<std::string, uint64_t>, ov::PropertyMutability::RO> memory_breakdown{"GPU_MEMORY_BREAKDOWN"};
 }  // namespace ov::intel_gpu
 
 namespace cldnn {
@@ -160,6 +160,7 @@ class memory_pool {
     engine* _engine;
     const ExecutionConfig& _config;
     float _mem_pool_util_threshold = 0.5f;
+    bool _use_size_classes = false;
 
 public:
     explicit memory_pool(engine& engine, const ExecutionConfig& config);
@@ -191,6 +192,9 @@ public:
     void clear_pool_for_network(uint32_t network_id);
     void release_memory(memory* memory, const size_t& unique_id, primitive_id prim_id, uint32_t network_id);
 
+    // rounds the allocation size up to one of the 4 classes between the adjacent powers of two
+    static size_t get_size_class(size_t bytes);
+
     size_t get_non_padded_pool_size() {
         return _non_padded_pool.size();
     }
@@ -37,15 +37,21 @@ OV_CONFIG_RELEASE_OPTION(ov::hint, activations_scale_factor, -1.0f, "Scalar floa
 OV_CONFIG_RELEASE_OPTION(ov::internal, enable_lp_transformations, false, "Enable/Disable Low precision transformations set")
 OV_CONFIG_RELEASE_OPTION(ov::intel_gpu, config_file, "", "Path to custom layers config file")
 OV_CONFIG_RELEASE_OPTION(ov::hint, model, nullptr, "Shared pointer to the ov::Model")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, kv_cache_uncompressed_layers, 0, "Number of the first and the last attention layers whose KV cache is kept uncompressed when KV cache compression is enabled")
 OV_CONFIG_RELEASE_OPTION(ov::internal, key_cache_quant_mode, ov::internal::CacheQuantMode::BY_CHANNEL, "AUTO or BY_CHANNEL or BY_TOKEN")
 OV_CONFIG_RELEASE_OPTION(ov::internal, value_cache_quant_mode, ov::internal::CacheQuantMode::BY_TOKEN, "AUTO or BY_CHANNEL or BY_TOKEN")
 OV_CONFIG_RELEASE_OPTION(ov::intel_gpu, mem_pool_util_threshold, 0.5, "Minimum utilization threshold (0.0~1.0) for reusable memory in the pool")
+OV_CONFIG_RELEASE_OPTION(ov::intel_gpu, shape_predictor_histogram_percentile, 0.0f, "Percentile (0.0~1.0) of the recent buffer sizes of a primitive output the dynamic buffers are preallocated to. 0 keeps the fixed preallocation ratio", [](float v) { return v >= 0.0f && v <= 1.0f; })
+OV_CONFIG_RELEASE_OPTION(ov::intel_gpu, shape_predictor_histogram_window, 64, "Number of the recent buffer sizes of a primitive output the preallocation percentile is computed over", [](size_t v) { return v > 0; })
+OV_CONFIG_RELEASE_OPTION(ov::intel_gpu, shape_predictor_shrink_idle_iterations, 0, "Number of consecutive iterations with an oversized dynamic buffer after which the buffer is reclaimed. 0 disables reclaiming")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, mem_pool_size_classes, false, "Round dynamic shape allocations of the memory pool up to size classes (4 per power of two), so the buffers are reused across the shapes instead of being allocated per shape")
 OV_CONFIG_RELEASE_OPTION(ov, enable_weightless, false, "Enable/Disable weightless blob")
 
-OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, shape_predictor_settings, {10, 16 * 1024, 2, 1.1f}, "Preallocation settings")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, shape_predictor_settings, {10, 16 * 1024, 2, 1.1f}, "Preallocation settings: next_iters_preallocation_count,max_per_iter_size,max_per_dim_diff,buffers_preallocation_ratio[,histogram_percentile,histogram_window,shrink_idle_iterations]")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, queue_type, QueueTypes::out_of_order, "Type of the queue that must be used for model execution. May be in-order or out-of-order")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, optimize_data, false, "Enable/Disable data flow optimizations for cldnn::program")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, enable_memory_pool, true, "Enable/Disable memory pool usage")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, weights_host_fallback, false, "Keep the weights in usm_host memory instead of usm_device when they do not fit into the device memory, so the kernels read them directly from host memory instead of failing with out of memory")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, allow_static_input_reorder, false, "Controls if weights tensors can be reordered during model compilation to more friendly layout for specific kernel")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, custom_outputs, std::vector<std::string>{}, "List of output primitive names")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, force_implementations, ImplForcingMap{}, "Specifies the list of forced implementations for the primitives")
@@ -53,7 +59,10 @@ OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, partial_build_program, false, "
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, allow_new_shape_infer, false, "Switch between new and old shape inference flow. Shall be removed soon")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, use_onednn, false, "Enable/Disable onednn for usage for particular model/platform")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, use_cm, true, "Enable/Disable CM for usage for particular model/platform")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, kernels_cache_dir, std::string(""), "Directory of the kernel binaries cache shared between all the models. The binaries are keyed by the hash of the batch source, build options and device/driver, so they are reused by any model with the same kernels batch. Overrides cache_dir for kernels if not empty")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, max_kernels_per_batch, 8, "Controls how many kernels we combine into batch for more efficient ocl compilation")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, async_compilation_threads, 1, "Number of threads used for asynchronous compilation of the shape-specific kernels of dynamic models. Values greater than 1 build the kernels of different primitives concurrently, which is experimental")
+OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, async_compilation_max_pending_tasks, 0, "Maximum number of pending asynchronous compilation tasks, the oldest ones are dropped when exceeded. 0 means no limit")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, impls_cache_capacity, 300, "Controls capacity of LRU implementations cache that is created for each program object for dynamic models")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, asym_dynamic_quantization, false, "Enforce asymmetric mode for dynamically quantized activations")
 OV_CONFIG_RELEASE_INTERNAL_OPTION(ov::intel_gpu, could_use_flashattn_v2, true, "Enable/Disable SDPA primitive executing with FlashAttenV2 online softmax tricks.")
@@ -5,8 +5,11 @@
 #pragma once
 
 #include "layout.hpp"
+#include "openvino/core/except.hpp"
 
 #include <deque>
+#include <istream>
+#include <ostream>
 
 namespace cldnn {
 
@@ -22,6 +25,18 @@ public:
 
         // Percentage mode preallocation
         float buffers_preallocation_ratio = 1.1f;
+
+        // Histogram mode preallocation, used instead of percentage mode if percentile is in (0, 1]
+        float histogram_percentile = 0.0f;
+        size_t histogram_window = 64;
+
+        // Number of consecutive iterations with oversized buffer after which the buffer is reclaimed, 0 disables it
+        size_t shrink_idle_iterations = 0;
+    };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
     };
 
     using Ptr = std::shared_ptr<ShapePredictor>;
@@ -38,7 +53,10 @@ public:
     ///        `_max_per_iter_size` and difference between shapes is less than `_max_per_dim_diff`; the second
     ///        operation mode is percentage preallocation - this mode can be configured with
     ///        ov::intel_gpu::buffers_preallocation_ratio property, it increases buffer size by
-    ///        `_buffers_preallocation_ratio` value unconditionally.
+    ///        `_buffers_preallocation_ratio` value unconditionally. If `histogram_percentile` is set (see
+    ///        ov::intel_gpu::shape_predictor_histogram_percentile and shape_predictor_histogram_window properties), the
+    ///        percentage mode is replaced with histogram mode - the buffer is preallocated to the given percentile
+    ///        of the last `histogram_window` buffer sizes requested by the primitive.
     /// \param id Primitive id.
     /// \param layout Primitive's layout on current iteration.
     /// \param can_reuse_buffer Specifies if current memory buffer is enough to store data.
@@ -59,20 +77,66 @@ public:
 
     bool can_preallocate(size_t desired_buffer_size);
 
+    /// \brief Checks if the buffer of primitive's output is oversized for `shrink_idle_iterations` consecutive
+    ///        iterations, i.e. if it is more than twice larger than both of the required size and the size predicted
+    ///        by the histogram, so it should be reclaimed.
+    /// \param id Primitive id.
+    /// \param out_idx output index of multiple outputs
+    /// \param required_size Number of elements required on current iteration.
+    /// \param allocated_size Number of elements of currently allocated buffer.
+    bool should_shrink(const std::string& id, size_t out_idx, size_t required_size, size_t allocated_size);
+
+    /// \brief Returns the number of predict_preallocation_shape() calls for which the current buffer could be
+    ///        reused (hits) or had to be reallocated (misses).
+    const Statistics& get_statistics() const {
+        return _statistics;
+    }
+
     void reset() {
         _shapes_info.clear();
+        _sizes_info.clear();
+        _idle_iters_info.clear();
     }
 
 private:
     void add_shape(const std::string& id, const ov::Shape& shape);
+    size_t get_percentile_size(const std::string& id_record) const;
 
     static constexpr size_t _max_deque_size = 3;
     std::map<std::string, std::deque<ov::Shape>> _shapes_info;
+    std::map<std::string, std::deque<size_t>> _sizes_info;
+    std::map<std::string, size_t> _idle_iters_info;
+    Statistics _statistics;
     const engine* _engine;
 
     const Settings _settings;
 };
 
+inline std::ostream& operator<<(std::ostream& os, const ShapePredictor::Settings& val) {
+    os << val.next_iters_preallocation_count << "," << val.max_per_iter_size << "," << val.max_per_dim_diff << ","
+       << val.buffers_preallocation_ratio << "," << val.histogram_percentile << "," << val.histogram_window << ","
+       << val.shrink_idle_iterations;
+    return os;
+}
+
+/// \brief Reads the settings in the format of operator<<, the histogram and shrinking fields are optional
+inline std::istream& operator>>(std::istream& is, ShapePredictor::Settings& val) {
+    ShapePredictor::Settings settings;
+    char delim = ',';
+    is >> settings.next_iters_preallocation_count >> delim >> settings.max_per_iter_size >> delim
+       >> settings.max_per_dim_diff >> delim >> settings.buffers_preallocation_ratio;
+    OPENVINO_ASSERT(!is.fail(), "[GPU] Unsupported ShapePredictor::Settings value");
+    if (is >> delim) {
+        is >> settings.histogram_percentile >> delim >> settings.histogram_window >> delim
+           >> settings.shrink_idle_iterations;
+        OPENVINO_ASSERT(!is.fail(), "[GPU] Unsupported ShapePredictor::Settings value");
+    } else {
+        is.clear(std::ios::eofbit);
+    }
+    val = settings;
+    return is;
+}
+
 }  // namespace cldnn
 
 namespace ov::intel_gpu {
@@ -5,6 +5,7 @@
 #include <mutex>
 #include <atomic>
 #include <unordered_set>
+#include <deque>
 #include <future>
 #include "intel_gpu/runtime/utils.hpp"
 #include "intel_gpu/runtime/compilation_context.hpp"
@@ -14,7 +15,9 @@
 namespace cldnn {
 class CompilationContext : public ICompilationContext {
 public:
-    CompilationContext(ov::threading::IStreamsExecutor::Config task_executor_config) : _task_executor_config(task_executor_config) {
+    CompilationContext(ov::threading::IStreamsExecutor::Config task_executor_config, size_t max_pending_tasks)
+        : _task_executor_config(task_executor_config)
+        , _max_pending_tasks(max_pending_tasks) {
         _task_executor = std::make_shared<ov::threading::CPUStreamsExecutor>(_task_executor_config);
     }
 
@@ -29,9 +32,17 @@ public:
         if (_task_keys.find(key) == _task_keys.end()) {
             if (_task_executor != nullptr) {
                 _task_keys.insert({key, promise->get_future()});
-                _task_executor->run([task, promise] {
-                    task();
-                    promise->set_value();
+                _pending_tasks.push_back({key, std::move(task), promise});
+                // The oldest pending tasks were created for the shapes which are likely not executed anymore,
+                // so drop them to let the kernels for the recent shapes be compiled sooner
+                if (_max_pending_tasks > 0 && _pending_tasks.size() > _max_pending_tasks) {
+                    auto& obsolete = _pending_tasks.front();
+                    _task_keys.erase(obsolete.key);
+                    obsolete.promise->set_value();
+                    _pending_tasks.pop_front();
+                }
+                _task_executor->run([this] {
+                    run_next_task();
                 });
             }
         }
@@ -62,15 +73,25 @@ public:
 
         _stop_compilation = true;
 
-        // Flush all remaining tasks.
+        // Drop the tasks which haven't been started yet, so only the running ones are waited for below
+        {
+            std::lock_guard<std::recursive_mutex> lock(_mutex);
+            for (auto& pending : _pending_tasks)
+                pending.promise->set_value();
+            _pending_tasks.clear();
+        }
+
         wait_all();
 
+        // The executor destructor joins the worker threads, so it must not be called under _mutex:
+        // the queued run_next_task() calls may still be executed by the workers
+        std::shared_ptr<ov::threading::IStreamsExecutor> task_executor;
         {
             std::lock_guard<std::recursive_mutex> lock(_mutex);
-            if (_task_executor != nullptr)
-                _task_executor.reset();
+            task_executor = std::move(_task_executor);
             _task_keys.clear();
         }
+        task_executor.reset();
     }
 
     void wait_all() override {
@@ -82,15 +103,42 @@ public:
     }
 
 private:
+    struct PendingTask {
+        kernel_impl_params key;
+        Task task;
+        std::shared_ptr<std::promise<void>> promise;
+    };
+
+    // Pending tasks are executed in LIFO order, as the most recent task is created for the shape
+    // which the next execution is going to wait for
+    void run_next_task() {
+        if (_stop_compilation)
+            return;
+
+        PendingTask pending;
+        {
+            std::lock_guard<std::recursive_mutex> lock(_mutex);
+            if (_pending_tasks.empty())
+                return;
+            pending = std::move(_pending_tasks.back());
+            _pending_tasks.pop_back();
+        }
+        pending.task();
+        pending.promise->set_value();
+    }
+
     ov::threading::IStreamsExecutor::Config _task_executor_config;
+    size_t _max_pending_tasks;
     std::shared_ptr<ov::threading::IStreamsExecutor> _task_executor;
     std::recursive_mutex _mutex;
     std::unordered_map<kernel_impl_params, std::future<void>, kernel_impl_params::Hasher> _task_keys;
+    std::deque<PendingTask> _pending_tasks;
     std::atomic_bool _stop_compilation{false};
 };
 
-std::shared_ptr<ICompilationContext> ICompilationContext::create(ov::threading::IStreamsExecutor::Config task_executor_config) {
-    return std::make_unique<CompilationContext>(task_executor_config);
+std::shared_ptr<ICompilationContext> ICompilationContext::create(ov::threading::IStreamsExecutor::Config task_executor_config,
+                                                                 size_t max_pending_tasks) {
+    return std::make_unique<CompilationContext>(task_executor_config, max_pending_tasks);
 }
 
 }  // namespace cldnn
@@ -6,6 +6,7 @@
 
 #include "intel_gpu/primitives/data.hpp"
 #include "intel_gpu/primitives/mutable_data.hpp"
+#include "intel_gpu/runtime/debug_configuration.hpp"
 #include "intel_gpu/runtime/itt.hpp"
 #include "pass_manager.h"
 #include "program_node.h"
@@ -86,4 +87,20 @@ void compile_graph::run(program& p) {
     if (exception) {
         std::rethrow_exception(exception);
     }
+
+    // Dynamic nodes without a shape-agnostic implementation get shape-specific kernels compiled at runtime, and a
+    // slower fallback runs until that compilation is done, so list them to make such stalls visible.
+    GPU_DEBUG_IF(p.get_config().get_verbose() >= 1) {
+        size_t not_shape_agnostic = 0;
+        for (const auto& node : proc_order) {
+            if (node->is_type<data>() || node->is_type<mutable_data>() || node->can_be_optimized() || !node->is_dynamic() ||
+                node->selected_impl != nullptr)
+                continue;
+            not_shape_agnostic++;
+            GPU_DEBUG_INFO << "[compile_graph] no shape-agnostic implementation for " << node->id() << " ("
+                           << node->get_primitive()->type_string() << ")" << std::endl;
+        }
+        GPU_DEBUG_INFO << "[compile_graph] " << not_shape_agnostic << " dynamic node(s) without shape-agnostic implementation"
+                       << std::endl;
+    }
 }
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "impls/cpu/cpu_impl_helpers.hpp"
 #include "assign_inst.h"
 #include "registry/implementation_map.hpp"
 #include "register.hpp"
@@ -54,6 +55,13 @@ struct assign_impl : public typed_primitive_impl<assign> {
 
         stream.wait_for_events(events);
 
+        // The producer may already write into the variable buffer (e.g. optimized out read_value chains), then the
+        // state is up to date and the copy to itself is skipped
+        if (instance.get_network().get_engine().is_the_same_buffer(*variable.get_memory(), instance.input_memory())) {
+            variable.set();
+            return make_output_event(stream, instance.is_output());
+        }
+
         const auto ev_set_memory = variable.get_memory()->copy_from(stream, instance.input_memory(), 0, 0, variable.get_layout().bytes_count(), true);
         variable.set();
 
@@ -29,6 +29,7 @@
 #endif
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <fstream>
@@ -90,7 +91,11 @@ namespace cldnn {
 std::mutex kernels_cache::_mutex;
 
 std::string kernels_cache::get_cache_path() const {
-    auto path = ov::util::path_to_string(_config.get_cache_dir());
+    // Global kernels cache is shared between models, so it has priority over the model cache dir
+    auto path = _config.get_kernels_cache_dir();
+    if (path.empty()) {
+        path = ov::util::path_to_string(_config.get_cache_dir());
+    }
     if (path.empty()) {
         return {};
     }
@@ -102,6 +107,10 @@ std::string kernels_cache::get_cache_path() const {
 }
 
 bool kernels_cache::is_cache_enabled() const {
+    if (!_config.get_kernels_cache_dir().empty()) {
+        return true;
+    }
+
     if (!_config.get_allow_new_shape_infer() &&
         (_config.get_cache_mode() == ov::CacheMode::OPTIMIZE_SPEED)) {
         return false;
@@ -270,7 +279,11 @@ kernels_cache::kernels_cache(engine& engine,
     , _task_executor(task_executor)
     , _config(config)
     , _prog_id(prog_id)
-    , batch_headers(std::move(batch_headers)) { }
+    , batch_headers(std::move(batch_headers)) {
+    if (!_config.get_kernels_cache_dir().empty()) {
+        ov::util::create_directory_recursive(_config.get_kernels_cache_dir());
+    }
+}
 
 void kernels_cache::build_batch(const batch_program& batch, compiled_kernels& compiled_kernels) {
     OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, "KernelsCache::build_batch");
@@ -420,10 +433,24 @@ void kernels_cache::build_all() {
 #endif
 
     if (_task_executor && use_threads) {
+        // The compile time of a batch grows with its source size, so the largest batches are submitted first to keep
+        // a single long compilation from being left alone at the tail of the queue while the other threads idle.
+        std::vector<std::pair<size_t, size_t>> order;
+        order.reserve(batches.size());
+        for (size_t idx = 0; idx < batches.size(); idx++) {
+            size_t source_size = 0;
+            for (const auto& s : batches[idx].source)
+                source_size += s.size();
+            order.emplace_back(source_size, idx);
+        }
+        std::stable_sort(order.begin(), order.end(), [](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) {
+            return a.first > b.first;
+        });
+
         std::exception_ptr exception;
         std::vector<ov::threading::Task> tasks;
-        for (size_t idx = 0; idx < batches.size(); idx++) {
-            auto& batch = batches[idx];
+        for (const auto& item : order) {
+            auto& batch = batches[item.second];
             tasks.push_back([this, &batch, &exception] {
                 try {
                     build_batch(batch, _kernels);
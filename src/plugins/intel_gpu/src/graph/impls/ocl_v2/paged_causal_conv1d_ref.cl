@@ -72,6 +72,12 @@ KERNEL(paged_causal_conv1d_ref)
         state[k] = convert_float(conv_state_table[read_state_base + k * state_kernel_stride]);
     }
 
+    float weight[KERNEL_SIZE];
+    const int w_base = h * weight_hidden_stride;
+    for (int k = 0; k < KERNEL_SIZE; k++) {
+        weight[k] = convert_float(conv_weight[w_base + k * weight_kernel_stride]);
+    }
+
     float bias_val = 0.0f;
 #if HAS_BIAS
     bias_val = convert_float(conv_bias[h * bias_hidden_stride]);
@@ -88,9 +94,8 @@ KERNEL(paged_causal_conv1d_ref)
         state[KERNEL_SIZE - 1] = convert_float(input_embeds[in_off]);
 
         float sum = bias_val;
-        const int w_base = h * weight_hidden_stride;
         for (int k = 0; k < KERNEL_SIZE; k++) {
-            sum = fma(state[k], convert_float(conv_weight[w_base + k * weight_kernel_stride]), sum);
+            sum = fma(state[k], weight[k], sum);
         }
 
         const int out_off = token_idx * output_token_stride + h * output_hidden_stride;
@@ -47,6 +47,7 @@
 #include <set>
 #include <utility>
 #include <map>
+#include <sstream>
 #include <functional>
 #include <fstream>
 
@@ -1248,6 +1249,41 @@ const ov::intel_gpu::VariablesMap& network::get_variables() const {
     return _variables_states;
 }
 
+std::map<std::string, uint64_t> network::get_memory_breakdown() const {
+    std::map<std::string, uint64_t> breakdown;
+    auto add = [&breakdown](const std::string& category, allocation_type type, uint64_t size) {
+        std::stringstream key;
+        key << category << ":" << type;
+        breakdown[key.str()] += size;
+    };
+
+    for (const auto& prim : _primitives) {
+        const bool is_constant = prim.second->get_node().is_constant();
+        if (!is_constant && !prim.second->mem_allocated())
+            continue;
+        for (size_t i = 0; i < prim.second->outputs_memory_count(); i++) {
+            const auto& mem = prim.second->output_memory_ptr(i);
+            if (!mem)
+                continue;
+            if (is_constant)
+                add("constant", mem->get_allocation_type(), mem->size());
+            add("primitive:" + prim.first, mem->get_allocation_type(), mem->size());
+        }
+    }
+
+    for (const auto& var : _variables_states) {
+        const auto& mem = var.second->get_memory();
+        if (mem)
+            add("variable", mem->get_allocation_type(), var.second->get_actual_mem_size());
+    }
+
+    for (auto type : {allocation_type::usm_host, allocation_type::usm_device}) {
+        add("memory_pool", type, _memory_pool->get_total_mem_pool_size(type));
+    }
+
+    return breakdown;
+}
+
 const ov::intel_gpu::VariablesInfoMap& network::get_variables_info() const {
     return _variables_state_info;
 }
@@ -1058,6 +1058,9 @@ void primitive_inst::realloc_outputs(bool prev_execution_skipped) {
         }
         if (required_buffer_size * 10 < _max_output_layout_count[i]) {
             reclaim = true;
+        } else if (!get_node().is_type<kv_cache>() && _outputs[i] &&
+                   sp.should_shrink(id(), i, required_buffer_size, _max_output_layout_count[i])) {
+            reclaim = true;
         }
         if (reclaim) {
             GPU_DEBUG_TRACE_DETAIL << id() << ": Updated output[" << i << "] size " << updated_layouts[i].get_linear_size()
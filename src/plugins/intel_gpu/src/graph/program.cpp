@@ -141,9 +141,10 @@ std::shared_ptr<ov::threading::IStreamsExecutor> program::make_task_executor(con
 }
 
 std::shared_ptr<ICompilationContext> program::make_compilation_context(const ExecutionConfig& config) {
-    const int _num_async_build_threads = 1;
+    const int _num_async_build_threads = static_cast<int>(std::max<size_t>(config.get_async_compilation_threads(), 1));
     return ICompilationContext::create(make_task_executor_config(config,
-                                                                 "Task executor config for CompilationContext in GPU plugin", _num_async_build_threads));
+                                                                 "Task executor config for CompilationContext in GPU plugin", _num_async_build_threads),
+                                       config.get_async_compilation_max_pending_tasks());
 }
 
 program::program(engine& engine_ref,
@@ -748,6 +749,20 @@ void program::transfer_memory_to_device() {
                 target_alloc_type = allocation_type::usm_device;
             }
 
+            // Leave the weights which do not fit into the device memory in host memory
+            if (target_alloc_type == allocation_type::usm_device && get_config().get_weights_host_fallback()) {
+                const auto memory_threshold = 0.90f;
+                const auto& info = get_engine().get_device_info();
+                const auto required_size = data_node_layout.bytes_count();
+                const auto device_mem_usage = get_engine().get_used_device_memory(allocation_type::usm_device);
+                if (required_size > info.max_alloc_mem_size ||
+                    device_mem_usage + required_size >= info.max_global_mem_size * memory_threshold) {
+                    GPU_DEBUG_LOG << "[" << data_node.id() << ": constant] keep " << alloc_type
+                                  << " memory as it does not fit into device memory" << std::endl;
+                    target_alloc_type = alloc_type;
+                }
+            }
+
             if (!mem_layout.compatible(data_node_layout)) {
                 if (data_node_layout.data_type == mem_layout.data_type &&
                     data_node_layout.format == mem_layout.format &&
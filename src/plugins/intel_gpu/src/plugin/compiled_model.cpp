@@ -344,6 +344,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             ov::PropertyName{ov::device::id.name(), PropertyMutability::RO},
             ov::PropertyName{ov::execution_devices.name(), PropertyMutability::RO},
             ov::PropertyName{ov::runtime_requirements.name(), PropertyMutability::RO},
+            ov::PropertyName{ov::intel_gpu::memory_breakdown.name(), PropertyMutability::RO},
         };
     } else if (name == ov::model_name) {
         return decltype(ov::model_name)::value_type {m_model_name};
@@ -358,6 +359,23 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return decltype(ov::execution_devices)::value_type{m_context->get_device_name()};
     } else if (name == ov::runtime_requirements) {
         return decltype(ov::runtime_requirements)::value_type{m_runtime_requirements};
+    } else if (name == ov::intel_gpu::memory_breakdown) {
+        decltype(ov::intel_gpu::memory_breakdown)::value_type res;
+        for (const auto& graph : m_graphs) {
+            // the same lock as the one held by infer(), so the memory isn't reallocated while it is being collected
+            std::lock_guard<std::mutex> lk(graph->get_mutex());
+            for (const auto& item : graph->get_network()->get_memory_breakdown())
+                res[item.first] += item.second;
+        }
+        // the engine counters cover all the models sharing the engine of the context, not only this one
+        auto& engine = m_context->get_engine();
+        for (auto type : {cldnn::allocation_type::usm_host, cldnn::allocation_type::usm_device}) {
+            std::stringstream type_str;
+            type_str << type;
+            res["engine_current:" + type_str.str()] = engine.get_used_device_memory(type);
+            res["engine_peak:" + type_str.str()] = engine.get_max_used_device_memory(type);
+        }
+        return res;
     }
 
     return m_config.get_property(name, OptionVisibility::RELEASE);
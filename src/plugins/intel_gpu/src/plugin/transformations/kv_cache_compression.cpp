@@ -32,6 +32,7 @@
 #include "transformations/utils/utils.hpp"
 
 #include <memory>
+#include <unordered_set>
 #include "openvino/core/graph_util.hpp"
 
 
@@ -133,10 +134,14 @@ std::shared_ptr<ov::intel_gpu::op::KVCacheCompressed>
 class KVCacheCompressionMatcher : public ov::pass::MatcherPass {
 public:
     OPENVINO_MATCHER_PASS_RTTI("KVCacheCompressionMatcher");
-    KVCacheCompressionMatcher(ov::element::Type compression_dt, bool supports_immad);
+    KVCacheCompressionMatcher(ov::element::Type compression_dt,
+                              bool supports_immad,
+                              std::shared_ptr<const std::unordered_set<const ov::Node*>> uncompressed_sdpa);
 };
 
-KVCacheCompressionMatcher::KVCacheCompressionMatcher(ov::element::Type compression_dt, bool supports_immad) {
+KVCacheCompressionMatcher::KVCacheCompressionMatcher(ov::element::Type compression_dt,
+                                                     bool supports_immad,
+                                                     std::shared_ptr<const std::unordered_set<const ov::Node*>> uncompressed_sdpa) {
     using namespace ov::pass::pattern;
 
     if (!cldnn::one_of(compression_dt, {element::i8, element::u8, element::i4, element::u4}))
@@ -184,6 +189,10 @@ KVCacheCompressionMatcher::KVCacheCompressionMatcher(ov::element::Type compressi
             return false;
         }
 
+        if (uncompressed_sdpa && uncompressed_sdpa->count(m.get_match_root().get())) {
+            return false;
+        }
+
         const auto& pattern_map = m.get_pattern_value_map();
 
         auto query_node = pattern_map.at(query).get_node_shared_ptr();
@@ -301,11 +310,27 @@ KVCacheCompressionMatcher::KVCacheCompressionMatcher(ov::element::Type compressi
 }
 
 bool KVCacheCompression::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    m_uncompressed_sdpa->clear();
+    if (m_uncompressed_layers > 0) {
+        // Keep the first and the last attention layers in higher precision as they are the most sensitive to quantization
+        std::vector<const ov::Node*> sdpa_nodes;
+        for (const auto& node : m->get_ordered_ops()) {
+            if (ov::is_type<ov::intel_gpu::op::IndirectSDPA>(node))
+                sdpa_nodes.push_back(node.get());
+        }
+        for (size_t i = 0; i < sdpa_nodes.size(); i++) {
+            if (i < m_uncompressed_layers || i + m_uncompressed_layers >= sdpa_nodes.size())
+                m_uncompressed_sdpa->insert(sdpa_nodes[i]);
+        }
+    }
+
     return pass::GraphRewrite::run_on_model(m);
 }
 
-KVCacheCompression::KVCacheCompression(ov::element::Type compression_dt, bool supports_immad) {
-    add_matcher<ov::intel_gpu::KVCacheCompressionMatcher>(compression_dt, supports_immad);
+KVCacheCompression::KVCacheCompression(ov::element::Type compression_dt, bool supports_immad, size_t uncompressed_layers)
+    : m_uncompressed_layers(uncompressed_layers)
+    , m_uncompressed_sdpa(std::make_shared<std::unordered_set<const ov::Node*>>()) {
+    add_matcher<ov::intel_gpu::KVCacheCompressionMatcher>(compression_dt, supports_immad, m_uncompressed_sdpa);
 }
 
 }  // namespace ov::intel_gpu
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "openvino/pass/graph_rewrite.hpp"
 
 namespace ov::intel_gpu {
@@ -33,9 +35,14 @@ class KVCacheCompression : public ov::pass::GraphRewrite {
 public:
 
     OPENVINO_GRAPH_REWRITE_RTTI("KVCacheCompression");
-    KVCacheCompression(ov::element::Type compression_dt, bool supports_immad);
+    /// \param uncompressed_layers Number of the first and the last attention layers whose KV cache is kept uncompressed
+    KVCacheCompression(ov::element::Type compression_dt, bool supports_immad, size_t uncompressed_layers = 0);
 
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+private:
+    size_t m_uncompressed_layers;
+    std::shared_ptr<std::unordered_set<const ov::Node*>> m_uncompressed_sdpa;
 };
 
 
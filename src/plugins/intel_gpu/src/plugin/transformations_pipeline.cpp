@@ -1615,7 +1615,9 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
 
         if (!has_shared_kv_cache_vars(func)) {
             auto kv_cache_compression_dt = config.get_kv_cache_precision();
-            manager.register_pass<ov::intel_gpu::KVCacheCompression>(kv_cache_compression_dt, device_info.supports_immad);
+            manager.register_pass<ov::intel_gpu::KVCacheCompression>(kv_cache_compression_dt,
+                                                                      device_info.supports_immad,
+                                                                      config.get_kv_cache_uncompressed_layers());
         }
 
         manager.register_pass<ov::intel_gpu::ConvertConvolutionToInternal>();
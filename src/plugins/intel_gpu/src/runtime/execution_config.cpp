@@ -357,6 +357,20 @@ void ExecutionConfig::finalize_impl(const IRemoteContext* context) {
         m_optimize_data = true;
     }
 
+    // The histogram and shrinking modes of the shape predictor are configured by the separate options as well
+    if (is_set_by_user(ov::intel_gpu::shape_predictor_histogram_percentile) ||
+        is_set_by_user(ov::intel_gpu::shape_predictor_histogram_window) ||
+        is_set_by_user(ov::intel_gpu::shape_predictor_shrink_idle_iterations)) {
+        auto settings = get_shape_predictor_settings();
+        if (is_set_by_user(ov::intel_gpu::shape_predictor_histogram_percentile))
+            settings.histogram_percentile = get_shape_predictor_histogram_percentile();
+        if (is_set_by_user(ov::intel_gpu::shape_predictor_histogram_window))
+            settings.histogram_window = get_shape_predictor_histogram_window();
+        if (is_set_by_user(ov::intel_gpu::shape_predictor_shrink_idle_iterations))
+            settings.shrink_idle_iterations = get_shape_predictor_shrink_idle_iterations();
+        m_shape_predictor_settings = settings;
+    }
+
     // Replace UINT8 KV-cache compression data type with INT8, as plugin is supposed to work with INT8 internally
     if (get_kv_cache_precision() == ov::element::u8) {
         m_kv_cache_precision = ov::element::i8;
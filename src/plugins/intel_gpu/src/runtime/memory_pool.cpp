@@ -202,6 +202,22 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
     }
     GPU_DEBUG_LOG << "[" << prim_id << "(" << unique_id << "): output]" << std::endl;
     // didn't find anything for you? create new resource
+    if (is_dynamic && _use_size_classes) {
+        // the buffer of the whole size class is pooled, so it may serve the other shapes of the same class later
+        const auto class_bytes_count = get_size_class(layout_bytes_count);
+        const cldnn::layout class_layout{ov::PartialShape{static_cast<int64_t>(class_bytes_count)}, data_types::u8, format::bfyx};
+        auto class_mem = alloc_memory(class_layout, type, reset);
+        _non_padded_pool.emplace(class_bytes_count,
+                                 memory_record({{MEM_USER(unique_id, network_id, prim_id, layout_bytes_count)}}, class_mem, network_id, type));
+#ifdef GPU_DEBUG_CONFIG
+        GPU_DEBUG_IF(_config.get_dump_memory_pool()) {
+            total_mem_size_non_padded_pool += class_bytes_count;
+            if (type == allocation_type::usm_host)
+                mem_size_non_padded_pool_host += class_bytes_count;
+        }
+#endif
+        return _engine->reinterpret_buffer(*class_mem, layout);
+    }
     auto mem = alloc_memory(layout, type, reset);
     {
         _non_padded_pool.emplace(layout_bytes_count,
@@ -219,6 +235,16 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
     return mem;
 }
 
+size_t memory_pool::get_size_class(size_t bytes) {
+    constexpr size_t classes_per_power_of_two = 4;
+    size_t power_of_two = 1;
+    while (power_of_two <= bytes / 2) {
+        power_of_two *= 2;
+    }
+    const size_t step = std::max<size_t>(power_of_two / classes_per_power_of_two, 1);
+    return (bytes + step - 1) / step * step;
+}
+
 memory::ptr memory_pool::get_from_padded_pool(const layout& layout,
                                               const primitive_id& prim_id,
                                               size_t unique_id,
@@ -413,6 +439,7 @@ memory_pool::memory_pool(engine& engine, const ExecutionConfig& config) : _engin
             << _mem_pool_util_threshold << std::endl;
     }
     GPU_DEBUG_TRACE_DETAIL << "mem_pool_util_threshold set to " << _mem_pool_util_threshold << std::endl;
+    _use_size_classes = _config.get_mem_pool_size_classes();
 }
 
 #ifdef GPU_DEBUG_CONFIG
@@ -5,6 +5,9 @@
 #include "intel_gpu/runtime/shape_predictor.hpp"
 #include "intel_gpu/runtime/engine.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace cldnn {
 
 static ov::Shape operator*(const ov::Shape& s1, const ov::Shape& s2) {
@@ -47,6 +50,52 @@ void ShapePredictor::add_shape(const std::string& id, const ov::Shape& shape) {
         shapes.pop_front();
 
     shapes.push_back(shape);
+
+    if (_settings.histogram_percentile > 0.0f) {
+        auto& sizes = _sizes_info[id];
+        if (sizes.size() >= std::max<size_t>(_settings.histogram_window, 1))
+            sizes.pop_front();
+
+        sizes.push_back(ov::shape_size(shape));
+    }
+}
+
+static std::string get_id_record(const std::string& id, size_t out_idx) {
+    if (out_idx > 0)
+        return id + "_out" + std::to_string(out_idx);
+    return id;
+}
+
+size_t ShapePredictor::get_percentile_size(const std::string& id_record) const {
+    auto it = _sizes_info.find(id_record);
+    if (it == _sizes_info.end() || it->second.empty())
+        return 0;
+
+    std::vector<size_t> sizes(it->second.begin(), it->second.end());
+    const auto percentile = std::min(_settings.histogram_percentile, 1.0f);
+    auto rank = static_cast<size_t>(std::ceil(percentile * static_cast<float>(sizes.size())));
+    auto nth = sizes.begin() + (std::max<size_t>(rank, 1) - 1);
+    std::nth_element(sizes.begin(), nth, sizes.end());
+    return *nth;
+}
+
+bool ShapePredictor::should_shrink(const std::string& id, size_t out_idx, size_t required_size, size_t allocated_size) {
+    if (_settings.shrink_idle_iterations == 0)
+        return false;
+
+    const auto id_record = get_id_record(id, out_idx);
+    const auto expected_size = std::max(required_size, get_percentile_size(id_record));
+    auto& idle_iters = _idle_iters_info[id_record];
+    if (allocated_size <= expected_size * 2) {
+        idle_iters = 0;
+        return false;
+    }
+
+    if (++idle_iters < _settings.shrink_idle_iterations)
+        return false;
+
+    idle_iters = 0;
+    return true;
 }
 
 bool ShapePredictor::can_preallocate(size_t desired_buffer_size) {
@@ -71,17 +120,17 @@ std::pair<bool, ov::Shape> ShapePredictor::predict_preallocation_shape(const std
     const auto& current_shape = layout.get_shape();
     auto dt_bitwidth = ov::element::Type(layout.data_type).bitwidth();
 
-    auto id_record = orig_id;
-    if (out_idx > 0) {
-        id_record += ("_out" + to_string(out_idx));
-    }
+    const auto id_record = get_id_record(orig_id, out_idx);
 
     add_shape(id_record, current_shape);
 
     // Save shape information and exit without pre-allocation suggestion if current
     // buffer can be reused
-    if (can_reuse_buffer)
+    if (can_reuse_buffer) {
+        _statistics.hits++;
         return {false, {}};
+    }
+    _statistics.misses++;
 
     // Avoid preallocation if spatial padded
     if (static_cast<bool>(layout.data_padding) && !layout.data_padding.is_dynamic()) {
@@ -156,6 +205,17 @@ std::pair<bool, ov::Shape> ShapePredictor::predict_preallocation_shape(const std
             auto preallocation_shape = diffs[0] * mul_shape;
             auto new_shape = current_shape + preallocation_shape;
             return {true, new_shape};
+        } else if (_settings.histogram_percentile > 0.0f) {
+            if (format::is_blocked(layout.format))
+                return {false, {}};
+            // Apply preallocation to the percentile of the recent buffer sizes
+            auto current_shape_size = ov::shape_size(current_shape);
+            auto percentile_size = get_percentile_size(id_record);
+            if (percentile_size <= current_shape_size)
+                return {false, {}};
+            ov::Shape new_shape_size(current_shape.size(), 1);
+            new_shape_size[0] = percentile_size;
+            return {true, new_shape_size};
         } else if (_settings.buffers_preallocation_ratio > 1.0f) {
             if (format::is_blocked(layout.format))
                 return {false, {}};
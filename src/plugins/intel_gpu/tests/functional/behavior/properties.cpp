@@ -5,6 +5,9 @@
 #include <algorithm>
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_gpu/properties.hpp"
+#include "intel_gpu/runtime/internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
 #include "shared_test_classes/base/ov_behavior_test_utils.hpp"
 #include "openvino/runtime/core.hpp"
 #include "common_test_utils/subgraph_builders/conv_pool_relu.hpp"
@@ -105,6 +108,43 @@ TEST_F(TestPropertiesGPU, RTInfoPropertiesWithUserValuesFromCompileModel) {
     ASSERT_EQ(scale.as<float>(), 4.0f);
 }
 
+TEST(ShapePredictorProperties, HistogramAndShrinkingFromCompileModel) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    ov::Core core;
+    ov::AnyMap config;
+    config[ov::intel_gpu::shape_predictor_histogram_percentile.name()] = "0.9";
+    config[ov::intel_gpu::shape_predictor_histogram_window.name()] = "8";
+    config[ov::intel_gpu::shape_predictor_shrink_idle_iterations.name()] = "2";
+    ov::CompiledModel compiled_model;
+    OV_ASSERT_NO_THROW(compiled_model = core.compile_model(model, ov::test::utils::DEVICE_GPU, config));
+    ASSERT_FLOAT_EQ(compiled_model.get_property(ov::intel_gpu::shape_predictor_histogram_percentile), 0.9f);
+    ASSERT_EQ(compiled_model.get_property(ov::intel_gpu::shape_predictor_histogram_window), 8);
+    ASSERT_EQ(compiled_model.get_property(ov::intel_gpu::shape_predictor_shrink_idle_iterations), 2);
+
+    // the large shape is followed by the small ones, so its buffer is reclaimed after two idle iterations
+    auto request = compiled_model.create_infer_request();
+    for (size_t batch : {64, 2, 3, 2, 3, 2, 64}) {
+        ov::Tensor input(ov::element::f32, {batch, 16});
+        auto data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = (i % 2 == 0) ? static_cast<float>(i) : -1.0f;
+        request.set_input_tensor(input);
+        OV_ASSERT_NO_THROW(request.infer());
+
+        auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), ov::Shape({batch, 16}));
+        auto out_data = output.data<float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(out_data[i], (i % 2 == 0) ? static_cast<float>(i) : 0.0f);
+    }
+
+    config[ov::intel_gpu::shape_predictor_histogram_percentile.name()] = "1.5";
+    ASSERT_ANY_THROW(core.compile_model(model, ov::test::utils::DEVICE_GPU, config));
+}
+
 // Test i4 -> u4 normalization in finalize_impl (no PA model required)
 TEST(KVCachePrecisionAutoDetection, I4NormalizedToU4) {
     auto model = ov::test::utils::make_conv_pool_relu();
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "intel_gpu/graph/kernel_impl_params.hpp"
+#include "intel_gpu/runtime/compilation_context.hpp"
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+kernel_impl_params make_key(int64_t dim) {
+    kernel_impl_params key;
+    key.input_layouts = {layout{ov::PartialShape{dim}, data_types::f32, format::bfyx}};
+    return key;
+}
+}  // namespace
+
+TEST(compilation_context, cancel_with_pending_tasks) {
+    auto context = ICompilationContext::create(ov::threading::IStreamsExecutor::Config{"compilation_context_test", 1});
+
+    std::atomic<bool> release{false};
+    std::atomic<size_t> started{0};
+    const size_t num_tasks = 8;
+    for (size_t i = 0; i < num_tasks; i++) {
+        context->push_task(make_key(static_cast<int64_t>(i + 1)), [&]() {
+            started++;
+            while (!release) {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    while (started == 0) {
+        std::this_thread::yield();
+    }
+    // the remaining tasks are still queued when the context is cancelled
+    context->remove_keys({make_key(1), make_key(2)});
+    std::thread releaser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        release = true;
+    });
+    context->cancel();
+    releaser.join();
+
+    ASSERT_TRUE(context->is_stopped());
+    ASSERT_EQ(started, 1);
+
+    // no new tasks are accepted after cancellation
+    context->push_task(make_key(100), [&]() {
+        started++;
+    });
+    context->wait_all();
+    ASSERT_EQ(started, 1);
+}
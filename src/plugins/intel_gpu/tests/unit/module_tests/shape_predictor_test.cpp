@@ -143,3 +143,59 @@ TEST(shape_predictor_tests, check_max_buffer_size) {
     const auto bytes_count = ov::shape_size(result.second);
     ASSERT_FALSE(sp.can_preallocate(bytes_count));
 }
+
+TEST(shape_predictor_tests, histogram_preallocation) {
+    auto& engine = get_test_engine();
+
+    ShapePredictor::Settings settings;
+    settings.histogram_percentile = 1.0f;
+    ShapePredictor sp(&engine, settings);
+
+    std::pair<bool, ov::Shape> result;
+    for (auto& shape : std::vector<ov::Shape>{{1, 512}, {1, 16}, {1, 100}, {1, 30}})
+        result = sp.predict_preallocation_shape("dummy_name", cldnn::layout(shape, ov::element::f32, format::bfyx), false);
+
+    ASSERT_TRUE(result.first);
+    ASSERT_EQ(result.second, ov::Shape({512, 1}));
+    ASSERT_EQ(sp.get_statistics().hits, 0);
+    ASSERT_EQ(sp.get_statistics().misses, 4);
+
+    settings.histogram_percentile = 0.5f;
+    ShapePredictor sp_median(&engine, settings);
+    for (auto& shape : std::vector<ov::Shape>{{1, 512}, {1, 16}, {1, 100}, {1, 30}})
+        result = sp_median.predict_preallocation_shape("dummy_name", cldnn::layout(shape, ov::element::f32, format::bfyx), false);
+
+    ASSERT_FALSE(result.first);
+}
+
+TEST(shape_predictor_tests, shrink_after_idle_iterations) {
+    auto& engine = get_test_engine();
+
+    ShapePredictor::Settings settings;
+    settings.shrink_idle_iterations = 2;
+    ShapePredictor sp(&engine, settings);
+
+    ASSERT_FALSE(sp.should_shrink("dummy_name", 0, 10, 100));
+    ASSERT_TRUE(sp.should_shrink("dummy_name", 0, 10, 100));
+    ASSERT_FALSE(sp.should_shrink("dummy_name", 0, 10, 100));
+    ASSERT_FALSE(sp.should_shrink("dummy_name", 0, 60, 100));
+    ASSERT_FALSE(sp.should_shrink("dummy_name", 0, 10, 100));
+}
+
+TEST(shape_predictor_tests, settings_from_string) {
+    auto settings = ov::Any("8,1024,3,1.5,0.9,32,4").as<ShapePredictor::Settings>();
+    ASSERT_EQ(settings.next_iters_preallocation_count, 8);
+    ASSERT_EQ(settings.max_per_iter_size, 1024);
+    ASSERT_EQ(settings.max_per_dim_diff, 3);
+    ASSERT_FLOAT_EQ(settings.buffers_preallocation_ratio, 1.5f);
+    ASSERT_FLOAT_EQ(settings.histogram_percentile, 0.9f);
+    ASSERT_EQ(settings.histogram_window, 32);
+    ASSERT_EQ(settings.shrink_idle_iterations, 4);
+
+    settings = ov::Any("8,1024,3,1.5").as<ShapePredictor::Settings>();
+    ASSERT_FLOAT_EQ(settings.histogram_percentile, 0.0f);
+    ASSERT_EQ(settings.histogram_window, 64);
+    ASSERT_EQ(settings.shrink_idle_iterations, 0);
+
+    ASSERT_ANY_THROW(ov::Any("8,1024").as<ShapePredictor::Settings>());
+}
@@ -984,4 +984,13 @@ TEST_F(memory_pool, non_opt_intermidate_opt_after_cached) {
 TEST_F(memory_pool, add_mem_dep_test_cached) {
     this->test_add_mem_dep(true);
 }
+
+TEST(memory_pool_size_classes, rounding) {
+    ASSERT_EQ(cldnn::memory_pool::get_size_class(1), size_t{1});
+    ASSERT_EQ(cldnn::memory_pool::get_size_class(1000), size_t{1024});
+    ASSERT_EQ(cldnn::memory_pool::get_size_class(1024), size_t{1024});
+    ASSERT_EQ(cldnn::memory_pool::get_size_class(1025), size_t{1280});
+    ASSERT_EQ(cldnn::memory_pool::get_size_class(5000), size_t{5120});
+    ASSERT_EQ(cldnn::memory_pool::get_size_class(7169), size_t{8192});
+}
 }
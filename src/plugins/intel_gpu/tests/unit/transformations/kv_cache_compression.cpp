@@ -782,6 +782,45 @@ TEST_F(TransformationTestsF, KVCacheCompressionPlanar) {
     }
 }
 
+TEST_F(TransformationTestsF, KVCacheCompressionUncompressedLayers) {
+    size_t concat_axis = 2;
+    size_t gather_axis = 0;
+    ov::element::Type_t element_type = ov::element::f16;
+    std::vector<int64_t> qkv_order = {0, 1, 2, 3};
+    ov::PartialShape input_shape = ov::PartialShape{1, 32, -1, 80};
+
+    {
+        auto query = std::make_shared<ov::op::v0::Parameter>(element_type, input_shape);
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{1});
+
+        auto key_variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{{1, 32, -1, 80}, ov::element::f16, "v0"});
+        auto key_current = std::make_shared<ov::op::v0::Parameter>(ov::element::f16, input_shape);
+        auto key_past = std::make_shared<ov::intel_gpu::op::ReadValue>(key_variable);
+        auto key_cache = std::make_shared<ov::intel_gpu::op::KVCache>(key_past, key_current, beam_idx, key_variable, concat_axis, gather_axis);
+
+        auto value_variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{{1, 32, -1, 80}, ov::element::f16, "v1"});
+        auto value_current = std::make_shared<ov::op::v0::Parameter>(ov::element::f16, input_shape);
+        auto value_past = std::make_shared<ov::intel_gpu::op::ReadValue>(value_variable);
+        auto value_cache = std::make_shared<ov::intel_gpu::op::KVCache>(value_past, value_current, beam_idx, value_variable, concat_axis, gather_axis);
+
+        ov::OutputVector sdpa_inputs = { query, key_cache->output(0), value_cache->output(0) };
+        auto sdpa = std::make_shared<ov::intel_gpu::op::IndirectSDPA>(sdpa_inputs,
+                                                                      key_cache->output(1),
+                                                                      false,
+                                                                      gather_axis,
+                                                                      qkv_order,
+                                                                      qkv_order,
+                                                                      qkv_order,
+                                                                      ov::intel_gpu::op::SDPA::default_order(4));
+
+        auto result = std::make_shared<ov::op::v0::Result>(sdpa);
+
+        model = std::make_shared<ov::Model>(ov::ResultVector{ result }, ov::ParameterVector{ beam_idx, query, key_current, value_current });
+        // The only attention layer is both the first and the last one, so it must stay uncompressed
+        manager.register_pass<KVCacheCompression>(ov::element::i8, false, 1);
+    }
+}
+
 }  // namespace intel_gpu
 }  // namespace test
 }  // namespace ov
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "compiled_model.hpp"
 #include "npuw_transformations/kv_axes_position.hpp"
@@ -17,6 +19,7 @@ class WhisperInferRequest;
 class LLMBlockKVCacheStrategy;
 class LLMContinuousKVCacheStrategy;
 struct PrefixCacheRestorationContext;
+class PrefixCacheManager;
 class LLMCompiledModel : public ov::npuw::ICompiledModel {
     using GetPropertiesMap =
         std::map<std::string, std::tuple<ov::PropertyMutability, std::function<ov::Any(const ::intel_npu::Config&)>>>;
@@ -123,6 +126,10 @@ private:
     bool m_enable_prefix_caching = false;
     uint64_t m_prefix_caching_block_size = 0;
     uint64_t m_prefix_caching_max_num_blocks = 0;
+    // Prefix caches are shared by all the infer requests of this model, so a prompt prefix computed by one request
+    // can be restored by any other one. Indexed the same way as LLMInferRequest::m_prefix_caching_helpers
+    std::mutex m_prefix_cache_mutex;
+    std::vector<std::shared_ptr<PrefixCacheManager>> m_prefix_cache_managers;
     uint64_t m_longrope_context_limit = 0;
 
     // Friend declarations for PrefixCachingHelper to access protected members
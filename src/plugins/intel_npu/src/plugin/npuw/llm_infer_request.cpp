@@ -323,7 +323,7 @@ ov::npuw::LLMInferRequest::LLMInferRequest(const std::shared_ptr<ov::npuw::LLMCo
         const size_t prefix_cache_count = m_npuw_llm_compiled_model->m_longrope_context_limit > 0u ? 2u : 1u;
         m_prefix_caching_helpers.reserve(prefix_cache_count);
         for (size_t i = 0; i < prefix_cache_count; ++i) {
-            m_prefix_caching_helpers.push_back(std::make_unique<PrefixCachingHelper>(*this));
+            m_prefix_caching_helpers.push_back(std::make_unique<PrefixCachingHelper>(*this, i));
         }
     }
 
@@ -708,7 +708,9 @@ void ov::npuw::LLMInferRequest::update_kvcache_for(
     namespace uu = ov::npuw::util;
     auto& kvcache_desc = m_npuw_llm_compiled_model->m_kvcache_desc;
 
-    for (std::size_t i = 0; i < m_kvcache_past_names.size(); ++i) {
+    // Layers are independent, so they are copied in parallel as in copy_kvcache(): the next prefill chunk
+    // depends on these past KV inputs and can't start before the copy is done
+    ov::parallel_for(m_kvcache_past_names.size(), [&](size_t i) {
         const auto& input_name = m_kvcache_past_names[i];
         OPENVINO_ASSERT(in_ports.find(input_name) != in_ports.end(),
                         "There is no ",
@@ -738,7 +740,7 @@ void ov::npuw::LLMInferRequest::update_kvcache_for(
         } else {
             uu::copy_tensor_by_dim(src_tensor, dst_slice, kv_dim, kv_dim);
         }
-    }
+    });
 }
 
 void ov::npuw::LLMInferRequest::copy_lincache(
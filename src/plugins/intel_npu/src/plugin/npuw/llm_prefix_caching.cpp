@@ -113,7 +113,9 @@ bool PrefixCacheManager::put_block(const std::shared_ptr<KVBlock>& block, uint64
         const auto curr_block = get_block_unsafe(block->get_block_hash());
         if (curr_block != nullptr) {
             // Update LRU position if block is evictable
-            update_evictable_lru_unsafe(curr_block->get_block_hash(), true);
+            if (curr_block->get_child_block_hashes().empty()) {
+                update_evictable_lru_unsafe(curr_block->get_block_hash(), true);
+            }
             LOG_VERB("[Cache store] Block already cached, updated LRU");
             return true;  // Already cached counts as success
         }
@@ -231,8 +233,9 @@ bool PrefixCacheManager::evict_lru_block_unsafe() {
 std::shared_ptr<KVBlock> PrefixCacheManager::get_block(uint64_t combined_hash) {
     std::lock_guard<std::mutex> lock(m_mutex);
     auto block = get_block_unsafe(combined_hash);
-    if (block != nullptr) {
-        // Update LRU position if block is evictable
+    // Update LRU position if block is evictable, the blocks with children are looked up by the requests sharing the
+    // prefix and must stay in the cache
+    if (block != nullptr && block->get_child_block_hashes().empty()) {
         update_evictable_lru_unsafe(block->get_block_hash(), true);
     }
     return block;
@@ -248,6 +251,7 @@ std::shared_ptr<KVBlock> PrefixCacheManager::get_block_unsafe(uint64_t combined_
 }
 
 void PrefixCacheManager::print_cache_status(bool verbose) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
     LOG_VERB("Cache Status:");
     LOG_VERB("Max Cache Size: " << m_max_cache_size);
     LOG_VERB("Number of Cached Blocks: " << m_cache_map.size());
@@ -272,10 +276,19 @@ void PrefixCacheManager::print_cache_status(bool verbose) const {
 // PrefixCachingHelper Implementation
 // ============================================================================
 
-PrefixCachingHelper::PrefixCachingHelper(LLMInferRequest& request)
-    : m_request(request),
-      m_cache_manager(
-          std::make_shared<PrefixCacheManager>(request.m_npuw_llm_compiled_model->m_prefix_caching_max_num_blocks)) {
+PrefixCachingHelper::PrefixCachingHelper(LLMInferRequest& request, size_t cache_idx) : m_request(request) {
+    auto& compiled_model = *m_request.m_npuw_llm_compiled_model;
+    {
+        std::lock_guard<std::mutex> lock(compiled_model.m_prefix_cache_mutex);
+        auto& managers = compiled_model.m_prefix_cache_managers;
+        if (managers.size() <= cache_idx) {
+            managers.resize(cache_idx + 1);
+        }
+        if (!managers[cache_idx]) {
+            managers[cache_idx] = std::make_shared<PrefixCacheManager>(compiled_model.m_prefix_caching_max_num_blocks);
+        }
+        m_cache_manager = managers[cache_idx];
+    }
     // Initialize name mapping once during construction
     create_name_mapping();
 }
@@ -140,7 +140,8 @@ public:
 
 private:
     size_t m_max_cache_size;
-    std::mutex m_mutex;
+    // Guards the map, the LRU list and the links of the cached blocks, the manager is shared by the infer requests
+    mutable std::mutex m_mutex;
     // Mapping from hash to KV blocks
     std::unordered_map<uint64_t, std::shared_ptr<KVBlock>> m_cache_map;
     // LRU list for evictable blocks only (leaf nodes with no children, most recent at front)
@@ -190,8 +191,9 @@ public:
     /**
      * @brief Construct a PrefixCachingHelper
      * @param request Reference to the LLMInferRequest that owns this helper
+     * @param cache_idx Index of the compiled model's prefix cache the helper works with
      */
-    explicit PrefixCachingHelper(LLMInferRequest& request);
+    PrefixCachingHelper(LLMInferRequest& request, size_t cache_idx);
 
     /**
      * @brief Prepare and restore prefix cache before inference
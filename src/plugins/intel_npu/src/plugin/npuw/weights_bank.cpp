@@ -54,6 +54,7 @@ int64_t Bank::registerLT(const LazyTensor& tensor, const std::string& device) {
 
     auto& device_bank = m_device_banks[device_for_alloc];
 
+    m_num_requests++;
     auto iter_registered = device_bank.registered_tensors.find(tensor);
     if (iter_registered == device_bank.registered_tensors.end()) {
         auto uid = uid_count++;
@@ -62,6 +63,7 @@ int64_t Bank::registerLT(const LazyTensor& tensor, const std::string& device) {
         return uid;
     } else {
         // Already registered - can be safely detach the incoming tensor
+        m_num_hits++;
         const_cast<LazyTensor&>(tensor).detach();
     }
 
@@ -110,6 +112,19 @@ void Bank::evaluate_and_allocate() {
             evaluate_and_allocate_on_device(device_bank, to_process, device_for_alloc);
         }
     }  // for (m_device_banks)
+
+    LOG_INFO("Weights bank " << m_bank_name << ": " << m_num_hits << " of " << m_num_requests
+                             << " registered tensors were shared");
+    LOG_BLOCK();
+    for (const auto& bank : m_device_banks) {
+        std::size_t bytes = 0;
+        for (const auto& el : bank.second.storage) {
+            if (el.second.tensor) {
+                bytes += el.second.tensor.get_byte_size();
+            }
+        }
+        LOG_INFO(bank.first << ": " << bank.second.storage.size() << " tensors, " << bytes / (1024 * 1024) << " MB");
+    }
 }
 
 void Bank::evaluate_cpu(Bank::DeviceBank& device_bank, const std::vector<LazyTensor>& to_process) {
@@ -76,6 +76,9 @@ private:
     std::shared_ptr<const ov::ICore> m_core = nullptr;
     std::string m_alloc_device;
     int64_t uid_count = 0;
+    // Registration statistics: how many tensors were requested and how many of them were already in the bank
+    std::size_t m_num_requests = 0;
+    std::size_t m_num_hits = 0;
     std::string m_bank_name;
 };
 
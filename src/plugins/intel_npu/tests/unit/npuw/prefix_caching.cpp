@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "llm_prefix_caching.hpp"
 
 TEST(PrefixCacheManagerTest, AddAndGetBlock) {
@@ -286,3 +288,77 @@ TEST(PrefixCacheManagerTest, PreventAddingBlock) {
 
     EXPECT_EQ(cache.get_block(block6->get_block_hash()), nullptr);
 }
+
+TEST(PrefixCacheManagerTest, ConcurrentRequests) {
+    /*
+        Test Purpose: Verify that the cache shared by the infer requests of a compiled model stays consistent when the
+       requests store and restore their blocks concurrently.
+
+        Every request stores a chain of blocks after the common system prompt block and restores it afterwards:
+            0
+          / | \
+         r0 r1 r2 ...
+
+        Expected Result:
+        - The restored blocks have the requested hashes.
+        - The parent of every cached block is cached as well, as only the blocks without children are evicted.
+    */
+    constexpr size_t cache_capability = 16;
+    ov::npuw::PrefixCacheManager cache(cache_capability);
+
+    constexpr size_t block_size = 2;
+    constexpr size_t num_requests = 4;
+    constexpr size_t chain_length = 8;
+    constexpr size_t iterations = 100;
+
+    auto make_block = [&](uint64_t first_hash) {
+        auto block = std::make_shared<ov::npuw::KVBlock>(block_size);
+        block->add_block({first_hash, first_hash + 1}, {});
+        return block;
+    };
+    const auto system_prompt = make_block(0x1);
+    ASSERT_TRUE(cache.put_block(system_prompt, 0));
+
+    auto request_block_hash = [](size_t request, size_t idx) {
+        return static_cast<uint64_t>(0x1000 * (request + 1) + 2 * idx);
+    };
+
+    std::vector<std::thread> requests;
+    for (size_t r = 0; r < num_requests; ++r) {
+        requests.emplace_back([&, r]() {
+            for (size_t it = 0; it < iterations; ++it) {
+                uint64_t prev_hash = system_prompt->get_block_hash();
+                for (size_t i = 0; i < chain_length; ++i) {
+                    auto block = make_block(request_block_hash(r, i) - 1);
+                    if (!cache.put_block(block, prev_hash)) {
+                        break;
+                    }
+                    prev_hash = block->get_block_hash();
+                }
+                for (size_t i = 0; i < chain_length; ++i) {
+                    const auto block = cache.get_block(request_block_hash(r, i));
+                    if (block == nullptr) {
+                        break;
+                    }
+                    EXPECT_EQ(block->get_block_hash(), request_block_hash(r, i));
+                }
+            }
+        });
+    }
+    for (auto& request : requests) {
+        request.join();
+    }
+
+    size_t cached_blocks = cache.get_block(system_prompt->get_block_hash()) != nullptr ? 1 : 0;
+    for (size_t r = 0; r < num_requests; ++r) {
+        for (size_t i = 0; i < chain_length; ++i) {
+            const auto block = cache.get_block(request_block_hash(r, i));
+            if (block == nullptr) {
+                continue;
+            }
+            cached_blocks++;
+            EXPECT_NE(cache.get_block(block->get_parent_block_hash()), nullptr);
+        }
+    }
+    EXPECT_LE(cached_blocks, cache_capability);
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
@@ -12,10 +13,17 @@
 namespace ov {
 namespace proxy {
 
+class RemoteContext;
+
 class InferRequest : public ov::IAsyncInferRequest {
 private:
     ov::SoPtr<ov::IAsyncInferRequest> m_infer_request;
     std::shared_ptr<const ov::ICompiledModel> m_compiled_model;
+    // Proxy context used to wrap the remote tensors, resolved once on the first remote tensor
+    mutable std::once_flag m_remote_context_flag;
+    mutable std::shared_ptr<ov::proxy::RemoteContext> m_remote_context;
+
+    ov::SoPtr<ov::ITensor> wrap_tensor(ov::SoPtr<ov::ITensor> tensor) const;
 
 public:
     InferRequest(ov::SoPtr<ov::IAsyncInferRequest>&& request,
@@ -47,18 +47,24 @@ std::vector<ov::ProfilingInfo> ov::proxy::InferRequest::get_profiling_info() con
     return m_infer_request->get_profiling_info();
 }
 
-ov::SoPtr<ov::ITensor> ov::proxy::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
-    auto tensor = m_infer_request->get_tensor(port);
+ov::SoPtr<ov::ITensor> ov::proxy::InferRequest::wrap_tensor(ov::SoPtr<ov::ITensor> tensor) const {
     if (!tensor._so)
         tensor._so = m_infer_request._so;
     if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr)) {
-        auto remote_context = std::dynamic_pointer_cast<ov::proxy::RemoteContext>(m_compiled_model->get_context()._ptr);
-        OPENVINO_ASSERT(remote_context);
-        tensor = remote_context->wrap_tensor(tensor);
+        std::call_once(m_remote_context_flag, [this] {
+            m_remote_context =
+                std::dynamic_pointer_cast<ov::proxy::RemoteContext>(m_compiled_model->get_context()._ptr);
+        });
+        OPENVINO_ASSERT(m_remote_context);
+        tensor = m_remote_context->wrap_tensor(tensor);
     }
     return tensor;
 }
 
+ov::SoPtr<ov::ITensor> ov::proxy::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    return wrap_tensor(m_infer_request->get_tensor(port));
+}
+
 void ov::proxy::InferRequest::set_tensor(const ov::Output<const ov::Node>& port, const ov::SoPtr<ov::ITensor>& tensor) {
     m_infer_request->set_tensor(port, ov::proxy::get_hardware_tensor(tensor, true));
 }
@@ -66,14 +72,7 @@ void ov::proxy::InferRequest::set_tensor(const ov::Output<const ov::Node>& port,
 std::vector<ov::SoPtr<ov::ITensor>> ov::proxy::InferRequest::get_tensors(const ov::Output<const ov::Node>& port) const {
     auto tensors = m_infer_request->get_tensors(port);
     for (auto&& tensor : tensors) {
-        if (!tensor._so)
-            tensor._so = m_infer_request._so;
-        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr)) {
-            auto remote_context =
-                std::dynamic_pointer_cast<ov::proxy::RemoteContext>(m_compiled_model->get_context()._ptr);
-            OPENVINO_ASSERT(remote_context);
-            tensor = remote_context->wrap_tensor(tensor);
-        }
+        tensor = wrap_tensor(std::move(tensor));
     }
     return tensors;
 }
@@ -81,6 +80,7 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::proxy::InferRequest::get_tensors(const o
 void ov::proxy::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                           const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
     std::vector<ov::SoPtr<ov::ITensor>> hw_tensors;
+    hw_tensors.reserve(tensors.size());
     for (auto& tensor : tensors) {
         hw_tensors.push_back(ov::proxy::get_hardware_tensor(tensor, true));
     }